@@ -0,0 +1,23 @@
+// Verdict printing shared by the host checks: one aligned line per verdict,
+// then a summary whose exit code fails the ctest run.
+
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+static void expect(bool ok, const char* tag, const char* what) {
+  if (!ok) failures++;
+  printf("[%s]%*s %-50s %s\n", tag, (int)(7 - strlen(tag)), "", what, ok ? "ok" : "FAIL");
+}
+
+// From main(): prints the summary, returns the exit code
+static int checkResult() {
+  printf("[CHECK] %s: %d wrong verdicts\n", failures ? "FAIL" : "PASS", failures);
+  return failures ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,42 @@
+// Accuracy of the Q16 helpers (src/fixed_math.h) against the float code
+// they replaced, over the whole input range. Exits non-zero if any error
+// bound is exceeded.
+
+#include <Arduino.h>
+#include "fixed_math.h"
+#include "eye_expressions.h"
+
+static int failures = 0;
+
+static void expectMaxError(const char* what, float err, float bound) {
+  const bool ok = err <= bound;
+  if (!ok) failures++;
+  printf("[MATH] %-12s max abs error %.6f (bound %.6f) %s\n", what, err, bound, ok ? "ok" : "FAIL");
+}
+
+int main() {
+  // Every phase of the quarter-wave table, both interpolated and exact
+  float sinErr = 0, cosErr = 0;
+  for (uint32_t p = 0; p < 65536; p++) {
+    const double a = p * (2.0 * M_PI / 65536.0);
+    sinErr = fmaxf(sinErr, fabs(q16ToFloat(q16Sin((uint16_t)p)) - sin(a)));
+    cosErr = fmaxf(cosErr, fabs(q16ToFloat(q16Cos((uint16_t)p)) - cos(a)));
+  }
+  expectMaxError("sin", sinErr, 1.3e-4f);
+  expectMaxError("cos", cosErr, 1.3e-4f);
+
+  // Curves at every Q16 step of [0, 1]
+  float smoothErr = 0, easeOutErr = 0, easeInErr = 0;
+  for (q16_t t = 0; t <= Q16_ONE; t++) {
+    const double tf = t / 65536.0, u = 1.0 - tf;
+    smoothErr = fmaxf(smoothErr, fabs(q16ToFloat(q16Smoothstep(t)) - tf * tf * (3.0 - 2.0 * tf)));
+    easeOutErr = fmaxf(easeOutErr, fabs(q16ToFloat(applyEase(EASE_OUT, t)) - (1.0 - u * u * u)));
+    easeInErr = fmaxf(easeInErr, fabs(q16ToFloat(applyEase(EASE_IN, t)) - tf * tf * tf));
+  }
+  expectMaxError("smoothstep", smoothErr, 8e-5f);
+  expectMaxError("ease out", easeOutErr, 4e-5f);
+  expectMaxError("ease in", easeInErr, 4e-5f);
+
+  printf("[MATH] %s\n", failures ? "FAIL" : "PASS");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,15 @@
+// Golden-frame check (src/frame_check.h) on the host: every behavior played
+// headless against golden_frames.h. Exits non-zero on any mismatching or
+// unrecorded frame.
+//
+//   frame_check           check
+//   frame_check --pgm     also print every sampled frame as PGM
+//                         (tools/extract_pgm.py cuts them out)
+
+#include <Arduino.h>
+#include "frame_check.h"
+
+int main(int argc, char** argv) {
+  const bool pgm = argc > 1 && strcmp(argv[1], "--pgm") == 0;
+  return FrameCheck::run(1.0f / ANIM_TICK_HZ, pgm) ? 1 : 0;
+}
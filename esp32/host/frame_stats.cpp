@@ -0,0 +1,43 @@
+// How many frames the main loop publishes per behavior once frameChanged()
+// (eye_engine.h) drops the ones that would look the same: 600 ticks at
+// ANIM_TICK_HZ, a frame offered every RENDER_FPS, as in loop(). Also the
+// I2C bytes the frames that do go out cost the full-buffer path.
+
+#include <Arduino.h>
+#include "frame_check.h"
+
+static const int RUN_TICKS = 600;
+
+int main() {
+  const float tickDt = 1.0f / ANIM_TICK_HZ;
+  const int ticksPerFrame = ANIM_TICK_HZ / RENDER_FPS;
+  U8G2_SH1106_128X64_HEADLESS display;
+  display.begin();
+  EyeEngine eye(display);
+  eye.setTickInterval(tickDt);
+
+  printf("[STATS] %d ticks at %d Hz, a frame offered every %d ticks (%d FPS)\n",
+         RUN_TICKS, ANIM_TICK_HZ, ticksPerFrame, RENDER_FPS);
+  for (uint8_t id = 0; id < BEH_COUNT; id++) {
+    randomSeed(GOLDEN_SEED + id);
+    eye.startBootSequence();
+    eye.stopClip();
+    eye.setTarget((BehaviorId)id);
+    eye.forceFrame();
+    const uint32_t bytes0 = eye.getFlushStats().bytesSent;
+
+    int offered = 0, sent = 0;
+    for (int t = 1; t <= RUN_TICKS; t++) {
+      eye.tick(tickDt);
+      if (t % ticksPerFrame) continue;
+      offered++;
+      EyeFrame f = eye.snapshot();
+      if (!eye.frameChanged(f)) continue;
+      eye.renderFrame(f);
+      sent++;
+    }
+    printf("[STATS] %-18s sent %3d of %d frames, %6lu B over I2C\n", BEHAVIORS[id].name, sent, offered,
+           (unsigned long)(eye.getFlushStats().bytesSent - bytes0));
+  }
+  return 0;
+}
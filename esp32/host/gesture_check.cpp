@@ -0,0 +1,61 @@
+// validGesture() (servo_gestures.h): every flash gesture must pass with the
+// run time the planner will take, and each way an uploaded program could
+// hurt the servo or hang the planner must be refused.
+
+#include <Arduino.h>
+#include "servo_gestures.h"
+#include "check.h"
+
+static void expectGesture(bool valid, const char* what, const uint8_t* code, uint8_t len) {
+  expect(validGesture(code, len) == valid, "GESTURE", what);
+}
+
+#define ACCEPTS(what, ...) do { const uint8_t c[] = { __VA_ARGS__ }; expectGesture(true, what, c, sizeof(c)); } while (0)
+#define REJECTS(what, ...) do { const uint8_t c[] = { __VA_ARGS__ }; expectGesture(false, what, c, sizeof(c)); } while (0)
+
+static void gestures() {
+  // Flash table: valid, and run for as long as the planner will take
+  static const uint32_t RUN_MS[GESTURE_COUNT] = {
+    150 + 3 * 450,                   // shake
+    200 + 2 * 600,                   // nod
+    400 + 1500 + 500,                // tilt
+    150 + 3 * (120 + 160) + 120,     // wiggle: body once, then repeated twice
+  };
+  for (uint8_t i = 0; i < GESTURE_COUNT; i++) {
+    uint32_t ms = 0;
+    const bool ok = validGesture(GESTURES[i].code, GESTURES[i].len, &ms) && ms == RUN_MS[i];
+    if (!ok) failures++;
+    printf("[GESTURE] %-50s %s (%lu ms)\n", GESTURES[i].name, ok ? "ok" : "FAIL", (unsigned long)ms);
+  }
+
+  ACCEPTS("swing touching both limits", G_MOVE(90, 100), G_OSC(30, 200, 2, 200), G_END);
+  ACCEPTS("run of exactly GESTURE_MAX_MS", G_MOVE(90, 100), G_HOLD(9950), G_REPEAT(1, 3), G_END);
+
+  REJECTS("swing past 120", G_MOVE(110, 100), G_OSC(15, 200, 2, 200), G_END);
+  REJECTS("swing below 60", G_MOVE(65, 100), G_OSC(10, 200, 2, 200), G_END);
+  REJECTS("move past 120", G_MOVE(121, 100), G_END);
+  REJECTS("swing before any move", G_OSC(5, 200, 2, 200), G_MOVE(90, 100), G_END);
+  REJECTS("swing with no half-swings", G_MOVE(90, 100), G_OSC(5, 200, 0, 200), G_END);
+  REJECTS("repeat body with no timed op", G_MOVE(90, 100), G_SYNC(1), G_REPEAT(3, 2), G_END);
+  REJECTS("nested repeat", G_MOVE(90, 100), G_MOVE(95, 100), G_REPEAT(1, 4), G_REPEAT(1, 11), G_END);
+  REJECTS("repeat into the middle of an op", G_MOVE(90, 100), G_MOVE(95, 100), G_REPEAT(1, 3), G_END);
+  REJECTS("repeat back past the start", G_MOVE(90, 100), G_REPEAT(1, 5), G_END);
+  REJECTS("repeat back 0", G_MOVE(90, 100), G_REPEAT(1, 0), G_END);
+  REJECTS("OP_EASE past SERVO_EASE_SMOOTH", G_MOVE(90, 100), G_EASE(SERVO_EASE_SMOOTH + 1), G_END);
+  REJECTS("run over GESTURE_MAX_MS", G_MOVE(90, 100), G_HOLD(9951), G_REPEAT(1, 3), G_END);
+  REJECTS("bytes after OP_END", G_MOVE(90, 100), G_END, G_HOLD(100));
+  REJECTS("no OP_END", G_MOVE(90, 100), G_HOLD(100));
+  REJECTS("op cut short", G_MOVE(90, 100), OP_HOLD, 100);
+  REJECTS("unknown op", G_MOVE(90, 100), OP_COUNT, G_END);
+  expectGesture(false, "empty", nullptr, 0);
+
+  uint8_t big[GESTURE_MAX_BYTES + 1];
+  memset(big, OP_SYNC, sizeof(big));
+  big[sizeof(big) - 1] = OP_END;
+  expectGesture(false, "longer than GESTURE_MAX_BYTES", big, sizeof(big));
+}
+
+int main() {
+  gestures();
+  return checkResult();
+}
@@ -0,0 +1,45 @@
+// The LED web input parsers (led_moods.h): parseHexColor() takes exactly six
+// hex digits and leaves the colour alone otherwise, findLedMood() resolves
+// every mood name and alias and nothing else.
+
+#include <Arduino.h>
+#include "led_moods.h"
+#include "check.h"
+
+static void ledInput() {
+  uint32_t rgb = 0;
+  expect(parseHexColor("#ff8000", rgb) && rgb == 0xFF8000, "LED", "colour #ff8000");
+  expect(parseHexColor("aBcDeF", rgb) && rgb == 0xABCDEF, "LED", "colour aBcDeF, no #");
+  const char* const badColors[] = { "", "#", "#fff", "#ff800", "#ff80001", "ff80zz", "##ff8000", "0xff8000", " ff8000" };
+  for (const char* s : badColors) {
+    rgb = 0x123456;
+    char what[48];
+    snprintf(what, sizeof(what), "colour \"%s\" rejected, value untouched", s);
+    expect(!parseHexColor(s, rgb) && rgb == 0x123456, "LED", what);
+  }
+
+  bool names = true;
+  for (uint8_t i = 0; i < MOOD_COUNT; i++) {
+    LedMoodId id = MOOD_COUNT;
+    if (!findLedMood(LED_MOODS[i].name, id) || id != i) names = false;
+  }
+  expect(names, "LED", "every LED_MOODS[] name finds its row");
+  bool aliases = true;
+  for (const LedMoodAlias& a : LED_MOOD_ALIASES) {
+    LedMoodId id = MOOD_COUNT;
+    if (!findLedMood(a.name, id) || id != a.id) aliases = false;
+  }
+  expect(aliases, "LED", "every alias finds its mood");
+  const char* const badMoods[] = { "", "Happy", "happy ", "disco" };
+  for (const char* s : badMoods) {
+    LedMoodId id = MOOD_COUNT;
+    char what[48];
+    snprintf(what, sizeof(what), "mood \"%s\" rejected", s);
+    expect(!findLedMood(s, id) && id == MOOD_COUNT, "LED", what);
+  }
+}
+
+int main() {
+  ledInput();
+  return checkResult();
+}
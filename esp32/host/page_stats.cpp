@@ -0,0 +1,67 @@
+// Full-buffer vs page-buffer render path (OLED_PAGE_BUFFER): I2C bytes per
+// frame for every behavior, every frame rendered (no frameChanged()), same
+// run as PerfBench::pageBuffer(). Then the static RAM only the full path
+// needs, as sized on this host.
+
+#include <Arduino.h>
+#include "frame_check.h"
+
+static const int FRAMES = 60;
+
+struct PathBytes {
+  uint32_t avg;
+  uint32_t max;
+};
+
+static PathBytes runPath(EyeEngine& eye, uint8_t id, float tickDt) {
+  randomSeed(GOLDEN_SEED + id);
+  eye.startBootSequence();
+  eye.stopClip();
+  eye.setTarget((BehaviorId)id);
+  eye.renderFrame(eye.snapshot());          // first frame is a full one on both paths
+  const uint32_t bytes0 = eye.getFlushStats().bytesSent;
+  uint32_t last = bytes0, maxBytes = 0;
+  for (int n = 0; n < FRAMES; n++) {
+    eye.tick(tickDt);
+    eye.tick(tickDt);
+    eye.renderFrame(eye.snapshot());
+    const uint32_t sent = eye.getFlushStats().bytesSent;
+    if (sent - last > maxBytes) maxBytes = sent - last;
+    last = sent;
+  }
+  return { (last - bytes0) / FRAMES, maxBytes };
+}
+
+int main() {
+  const float tickDt = 1.0f / ANIM_TICK_HZ;
+  U8G2_SH1106_128X64_HEADLESS fullDisplay;
+  U8G2_SH1106_128X64_HEADLESS_PAGED pagedDisplay;
+  fullDisplay.begin();
+  pagedDisplay.begin();
+  EyeEngine full(fullDisplay), paged(pagedDisplay);
+
+  printf("[PAGES] I2C bytes per frame over %d frames (avg / max)\n", FRAMES);
+  uint32_t avgLo[2] = { UINT32_MAX, UINT32_MAX }, avgHi[2] = { 0, 0 }, worst[2] = { 0, 0 };
+  for (uint8_t id = 0; id < BEH_COUNT; id++) {
+    const PathBytes b[2] = { runPath(full, id, tickDt), runPath(paged, id, tickDt) };
+    for (int p = 0; p < 2; p++) {
+      if (b[p].avg < avgLo[p]) avgLo[p] = b[p].avg;
+      if (b[p].avg > avgHi[p]) avgHi[p] = b[p].avg;
+      if (b[p].max > worst[p]) worst[p] = b[p].max;
+    }
+    printf("[PAGES] %-18s full %4lu / %4lu B   paged %4lu / %4lu B\n", BEHAVIORS[id].name,
+           (unsigned long)b[0].avg, (unsigned long)b[0].max, (unsigned long)b[1].avg, (unsigned long)b[1].max);
+  }
+  printf("[PAGES] averages           full %lu-%lu B        paged %lu-%lu B\n",
+         (unsigned long)avgLo[0], (unsigned long)avgHi[0], (unsigned long)avgLo[1], (unsigned long)avgHi[1]);
+  printf("[PAGES] worst frame        full %lu B            paged %lu B\n",
+         (unsigned long)worst[0], (unsigned long)worst[1]);
+
+  const uint32_t fullRam = TileFlusher::FRAME_BYTES + sizeof(TileFlusher) +
+                           sizeof(EyeShapeCache) + sizeof(StopwatchView);
+  const uint32_t pagedRam = 128u * pagedDisplay.getBufferTileHeight();
+  printf("[PAGES] RAM full=%luB (buffer %u + tile shadow %u + shape cache %u + stopwatch %u) paged=%luB\n",
+         (unsigned long)fullRam, TileFlusher::FRAME_BYTES, (unsigned)sizeof(TileFlusher),
+         (unsigned)sizeof(EyeShapeCache), (unsigned)sizeof(StopwatchView), (unsigned long)pagedRam);
+  return 0;
+}
@@ -0,0 +1,117 @@
+// Power budget at LED_MAX_BRIGHTNESS: every LED mood for 10 s with the head
+// swinging 70 <-> 110 every 2 s, once silent and once with audio playing,
+// in main.cpp's loop order (ticks, servo, budget, render) on a stepped
+// clock. Prints what the ring asks for, what it was let show, the highest
+// estimated total and what the budget had to do to get there.
+
+#include <Arduino.h>
+#include "anim_clock.h"
+#include "power_budget.h"
+
+static const uint32_t RUN_MS = 10000;
+static const uint32_t SWING_MS = 2000;
+static const uint32_t LOOP_US = 1000;
+
+static uint64_t clockUs = 1000000;
+
+struct RunFigures {
+  uint16_t asksMa = 0;          // ring with no limit
+  uint16_t showsMa = 0;         // ring under the budget
+  uint16_t totalMa = 0;         // highest estimated total
+  uint32_t violations = 0;
+  uint32_t overMs = 0;
+  uint32_t holds = 0;
+  uint32_t limited = 0;
+};
+
+static void show(LedController& leds, LedMoodId id) {
+  if (LED_MOODS[id].overlayMs) leds.showOverlay(id, LED_MOODS[id].overlayMs, 0);
+  else leds.setMood(id, 0);
+}
+
+static RunFigures run(LedMoodId id, bool audio, LedController& leds, LedController& asks,
+                      ServoController& servo, PowerBudget& power, AnimClock& clock) {
+  static uint8_t bands[NUM_LEDS];
+  memset(bands, 0xFF, sizeof(bands));
+  if (LED_MOODS[id].overlayMs) {
+    leds.setMood(MOOD_OFF, 0);
+    asks.setMood(MOOD_OFF, 0);
+  }
+  show(leds, id);
+  show(asks, id);
+
+  const PowerStats before = power.stats();
+  const uint32_t limitedBefore = leds.stats().limited;
+  RunFigures f;
+  bool right = false;
+  for (uint32_t ms = 0; ms < RUN_MS; ms++) {
+    clockUs += LOOP_US;
+    hostSetClockUs(clockUs);
+    if (ms % SWING_MS == 0) {
+      servo.moveTo(right ? 110 : 70, 0);
+      right = !right;
+    }
+    if (id == MOOD_VOICE && ms % 16 == 0) {
+      leds.voiceReact(bands);
+      asks.voiceReact(bands);
+    } else if (LED_MOODS[id].overlayMs && ms % 100 == 0) {
+      show(leds, id);
+      show(asks, id);
+    }
+
+    const uint8_t ticks = clock.advance(micros());
+    for (uint8_t i = 0; i < ticks; i++) {
+      leds.tick(clock.tickDt());
+      asks.tick(clock.tickDt());
+    }
+    servo.update();
+    power.update(leds, servo, audio);
+    if (power.stats().totalMa > f.totalMa) f.totalMa = power.stats().totalMa;
+    if (clock.renderDue(micros())) {
+      leds.render(clock.alpha());
+      asks.render(clock.alpha());
+      f.asksMa = max(f.asksMa, asks.currentMa());
+      f.showsMa = max(f.showsMa, leds.currentMa());
+    }
+  }
+  const PowerStats& st = power.stats();
+  f.violations = st.violations - before.violations;
+  f.overMs = st.overMs - before.overMs;
+  f.holds = st.servoHolds - before.servoHolds;
+  f.limited = leds.stats().limited - limitedBefore;
+  return f;
+}
+
+int main() {
+  hostSetClockUs(clockUs);
+  static LedController leds, asks;
+  static ServoController servo;
+  static PowerBudget power;
+  AnimClock clock;
+  leds.begin();
+  asks.begin();
+  servo.begin();
+  power.begin(POWER_BUDGET_MA);
+  clock.begin(ANIM_TICK_HZ, RENDER_FPS, ANIM_MAX_CATCHUP_TICKS);
+
+  printf("[POWER] LED_MAX_BRIGHTNESS %d, budget %u mA, %lu s per run, servo start every %lu ms\n",
+         LED_MAX_BRIGHTNESS, POWER_BUDGET_MA, (unsigned long)(RUN_MS / 1000), (unsigned long)SWING_MS);
+  printf("[POWER] %-10s %-6s %10s %10s %10s %6s %7s %6s %8s\n",
+         "mood", "audio", "ring asks", "ring shows", "peak total", "over", "over ms", "holds", "limited");
+  uint16_t worst = 0;
+  uint32_t violations = 0;
+  for (uint8_t m = 0; m < MOOD_COUNT; m++) {
+    for (uint8_t a = 0; a < 2; a++) {
+      const RunFigures f = run((LedMoodId)m, a, leds, asks, servo, power, clock);
+      printf("[POWER] %-10s %-6s %7u mA %7u mA %7u mA %6lu %7lu %6lu %8lu\n",
+             LED_MOODS[m].name, a ? "on" : "off", f.asksMa, f.showsMa, f.totalMa,
+             (unsigned long)f.violations, (unsigned long)f.overMs, (unsigned long)f.holds,
+             (unsigned long)f.limited);
+      worst = max(worst, f.totalMa);
+      violations += f.violations;
+    }
+  }
+  printf("[POWER] worst total %u mA of %u, %lu violations\n",
+         worst, POWER_BUDGET_MA, (unsigned long)violations);
+  return 0;
+}
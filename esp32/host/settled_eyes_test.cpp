@@ -0,0 +1,74 @@
+// Settled eyes of every behavior, drawn by the Q16 engine, against the float
+// drawEye() the engine used before fixed_math.h: same pixels or the run
+// fails. Only the expression shape is compared; blink, saccades, particles
+// and clips are taken out of both frames.
+
+#include <Arduino.h>
+#include "frame_check.h"
+
+static const int SETTLE_TICKS = 600;   // longest entry transition, with margin
+static const int EYE_CX[2] = { 32, 96 }, EYE_CY = 32;   // EyeEngine's eye centers
+
+// The float path: parameters straight from the expression table, pixel math
+// as it was
+static void drawFloatEye(U8G2& display, int cx, int cy, const EyeExpression& e) {
+  const float width = e.width, height = e.height, blink = 1.0f;
+  const float offsetX = e.offsetX, offsetY = e.offsetY;
+
+  int w = constrain((int)width, 20, 40);
+  int h = constrain((int)(height * blink), 4, 52);
+  int totalOffsetX = constrain((int)offsetX, -10, 10);
+  int totalOffsetY = constrain((int)offsetY, -8, 8);
+  int x = constrain(cx + totalOffsetX - (w / 2), 0, 128 - w);
+  int y = constrain(cy + totalOffsetY - (h / 2), 0, 64 - h);
+  int r = (h < 16) ? (h / 2) : 8;
+  int topH = (int)(h * e.topLid);
+  int botH = (int)(h * e.bottomLid);
+
+  display.setDrawColor(1);
+  display.drawRBox(x, y, w, h, r);
+  display.setDrawColor(0);
+  if (topH > 0) display.drawBox(x, y, w, topH);
+  if (botH > 0) display.drawBox(x, y + h - botH, w, botH);
+}
+
+int main() {
+  const float tickDt = 1.0f / ANIM_TICK_HZ;
+  U8G2_SH1106_128X64_HEADLESS display;
+  display.begin();
+  EyeEngine eye(display);
+  eye.setTickInterval(tickDt);
+
+  int failures = 0;
+  uint8_t fixedBuf[1024];
+  for (uint8_t id = 0; id < BEH_COUNT; id++) {
+    randomSeed(GOLDEN_SEED + id);
+    eye.startBootSequence();
+    eye.stopClip();
+    eye.setTarget((BehaviorId)id);
+    for (int t = 0; t < SETTLE_TICKS; t++) eye.tick(tickDt);
+
+    EyeFrame f = eye.snapshot();
+    f.view.blink = Q16_ONE;
+    f.view.saccadeX = f.view.saccadeY = 0;
+    f.particles.count = 0;
+    f.clip = CLIP_NONE;
+    f.subtitleId = 0;
+    eye.rasterize(f);
+    memcpy(fixedBuf, display.getBufferPtr(), sizeof(fixedBuf));
+
+    display.clearBuffer();
+    for (int e = 0; e < 2; e++) drawFloatEye(display, EYE_CX[e], EYE_CY, EYE_EXPRESSIONS[id]);
+
+    int diff = 0;
+    for (int i = 0; i < 1024; i++) diff += __builtin_popcount(fixedBuf[i] ^ display.getBufferPtr()[i]);
+    if (diff) failures++;
+    printf("[EYES] %-18s %s", BEHAVIORS[id].name, diff ? "FAIL" : "ok");
+    if (diff) printf(" (%d pixels differ)", diff);
+    printf("\n");
+  }
+
+  printf("[EYES] %s: %d of %d behaviors differ from the float path\n",
+         failures ? "FAIL" : "PASS", failures, (int)BEH_COUNT);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,25 @@
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+#include <stdint.h>
+
+// The strip as LedOutput's synchronous path uses it: a pixel buffer that
+// show() sends nowhere
+#define NEO_GRB 0x52
+#define NEO_KHZ800 0x0000
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t, uint16_t) : pixels_(new uint8_t[n * 3]()) {}
+  ~Adafruit_NeoPixel() { delete[] pixels_; }
+  void begin() {}
+  void show() {}
+  uint8_t* getPixels() const { return pixels_; }
+
+private:
+  Adafruit_NeoPixel(const Adafruit_NeoPixel&);
+  Adafruit_NeoPixel& operator=(const Adafruit_NeoPixel&);
+  uint8_t* pixels_;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// ============================================================================
+// HOST ARDUINO - Just enough of the Arduino core to run the eye engine on Linux
+// ============================================================================
+// millis()/micros() are the host's monotonic clock (the eye engine itself is
+// stepped by tick, so time only reaches the cost figures and debug logs),
+// unless a simulation steps its own clock with hostSetClockUs().
+// random() is a fixed LCG rather than libc rand(), so golden frames hash the
+// same on every host.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include "Print.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PI 3.1415926535897932384626433832795
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+int analogRead(uint8_t pin);
+
+// Host only: millis()/micros() return us from now on
+void hostSetClockUs(uint64_t us);
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
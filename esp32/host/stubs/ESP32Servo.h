@@ -0,0 +1,12 @@
+#ifndef HOST_ESP32SERVO_H
+#define HOST_ESP32SERVO_H
+
+// The servo as ServoController drives it: pulses go nowhere
+class Servo {
+public:
+  void setPeriodHertz(int) {}
+  int attach(int, int, int) { return 0; }
+  void writeMicroseconds(int) {}
+};
+
+#endif
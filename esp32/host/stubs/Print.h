@@ -0,0 +1,49 @@
+#ifndef HOST_PRINT_H
+#define HOST_PRINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// Arduino Print, as U8g2's C++ classes and Serial use it
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    size_t done = 0;
+    while (n--) done += write(*buf++);
+    return done;
+  }
+  size_t write(const char* s) { return write((const uint8_t*)s, strlenOf(s)); }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+  size_t println() { return write((uint8_t)'\n'); }
+  template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+  }
+
+private:
+  static size_t strlenOf(const char* s) {
+    size_t n = 0;
+    while (s && s[n]) n++;
+    return n;
+  }
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include <Arduino.h>
+#include <chrono>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "driver/i2c.h"
+#include "driver/rmt.h"
+#include "esp_timer.h"
+
+HardwareSerial Serial;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static uint32_t rngState = 1;
+
+static bool manualClock = false;
+static uint64_t manualUs = 0;
+
+static uint64_t elapsedUs() {
+  if (manualClock) return manualUs;
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long millis() { return (unsigned long)(elapsedUs() / 1000); }
+unsigned long micros() { return (unsigned long)elapsedUs(); }
+void hostSetClockUs(uint64_t us) {
+  manualClock = true;
+  manualUs = us;
+}
+void delay(unsigned long) {}
+void delayMicroseconds(unsigned int) {}
+void yield() {}
+
+// Numerical Recipes LCG, high bits only
+static uint32_t nextRandom() {
+  rngState = rngState * 1664525UL + 1013904223UL;
+  return rngState >> 8;
+}
+
+void randomSeed(unsigned long seed) { if (seed) rngState = (uint32_t)seed; }
+long random(long howbig) { return howbig > 0 ? (long)(nextRandom() % (uint32_t)howbig) : 0; }
+long random(long howsmall, long howbig) { return howbig > howsmall ? howsmall + random(howbig - howsmall) : howsmall; }
+int analogRead(uint8_t) { return 0; }
+
+// No scheduler on the host: task and driver set-up fails, so every
+// transport (and the servo planner) falls back to its synchronous path
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*, BaseType_t) { return pdFAIL; }
+void vTaskDelay(TickType_t) {}
+void xTaskNotifyGive(TaskHandle_t) {}
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+QueueHandle_t xQueueCreate(UBaseType_t, UBaseType_t) { return nullptr; }
+BaseType_t xQueueSend(QueueHandle_t, const void*, TickType_t) { return pdFAIL; }
+BaseType_t xQueueReceive(QueueHandle_t, void*, TickType_t) { return pdFAIL; }
+
+esp_err_t i2c_param_config(i2c_port_t, const i2c_config_t*) { return ESP_FAIL; }
+esp_err_t i2c_driver_install(i2c_port_t, i2c_mode_t, size_t, size_t, int) { return ESP_FAIL; }
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t*, uint32_t) { return nullptr; }
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t) {}
+esp_err_t i2c_master_start(i2c_cmd_handle_t) { return ESP_FAIL; }
+esp_err_t i2c_master_stop(i2c_cmd_handle_t) { return ESP_FAIL; }
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t, uint8_t, bool) { return ESP_FAIL; }
+esp_err_t i2c_master_write(i2c_cmd_handle_t, const uint8_t*, size_t, bool) { return ESP_FAIL; }
+esp_err_t i2c_master_cmd_begin(i2c_port_t, i2c_cmd_handle_t, TickType_t) { return ESP_FAIL; }
+
+esp_err_t rmt_config(const rmt_config_t*) { return ESP_FAIL; }
+esp_err_t rmt_driver_install(rmt_channel_t, size_t, int) { return ESP_FAIL; }
+esp_err_t rmt_translator_init(rmt_channel_t, sample_to_rmt_t) { return ESP_FAIL; }
+esp_err_t rmt_write_sample(rmt_channel_t, const uint8_t*, size_t, bool) { return ESP_FAIL; }
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t*, esp_timer_handle_t*) { return ESP_FAIL; }
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t, uint64_t) { return ESP_FAIL; }
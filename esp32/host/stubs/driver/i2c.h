@@ -0,0 +1,37 @@
+#ifndef HOST_DRIVER_I2C_H
+#define HOST_DRIVER_I2C_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+
+typedef int i2c_port_t;
+typedef enum { I2C_MODE_SLAVE, I2C_MODE_MASTER } i2c_mode_t;
+typedef enum { I2C_MASTER_WRITE, I2C_MASTER_READ } i2c_rw_t;
+#define GPIO_PULLUP_ENABLE 1
+#define I2C_LINK_RECOMMENDED_SIZE(n) (2 * (n) * 20)
+
+typedef struct {
+  i2c_mode_t mode;
+  int sda_io_num;
+  int scl_io_num;
+  int sda_pullup_en;
+  int scl_pullup_en;
+  struct { uint32_t clk_speed; } master;
+  uint32_t clk_flags;
+} i2c_config_t;
+
+typedef void* i2c_cmd_handle_t;
+
+esp_err_t i2c_param_config(i2c_port_t port, const i2c_config_t* conf);
+esp_err_t i2c_driver_install(i2c_port_t port, i2c_mode_t mode, size_t rxBuf, size_t txBuf, int flags);
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t* buf, uint32_t size);
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ackEn);
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd, const uint8_t* data, size_t len, bool ackEn);
+esp_err_t i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t wait);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef HOST_DRIVER_RMT_H
+#define HOST_DRIVER_RMT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+typedef int rmt_channel_t;
+
+typedef struct {
+  rmt_channel_t channel;
+  uint8_t clk_div;
+} rmt_config_t;
+
+#define RMT_DEFAULT_CONFIG_TX(gpio, ch) rmt_config_t{ (ch), 80 }
+
+typedef union {
+  struct {
+    uint32_t duration0 : 15;
+    uint32_t level0 : 1;
+    uint32_t duration1 : 15;
+    uint32_t level1 : 1;
+  };
+  uint32_t val;
+} rmt_item32_t;
+
+typedef void (*sample_to_rmt_t)(const void* src, rmt_item32_t* dest, size_t srcSize,
+                                size_t wanted, size_t* translated, size_t* items);
+
+esp_err_t rmt_config(const rmt_config_t* conf);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBuf, int flags);
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn);
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t* src, size_t size, bool wait);
+
+#endif
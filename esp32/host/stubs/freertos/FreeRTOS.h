@@ -0,0 +1,19 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef void* QueueHandle_t;
+typedef void* TaskHandle_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define pdMS_TO_TICKS(ms) (ms)
+#define portMAX_DELAY 0xFFFFFFFF
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef HOST_FREERTOS_QUEUE_H
+#define HOST_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t wait);
+BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t wait);
+
+#endif
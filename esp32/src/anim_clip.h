@@ -0,0 +1,149 @@
+#ifndef ANIM_CLIP_H
+#define ANIM_CLIP_H
+
+#include <Arduino.h>
+#include "clip_boot.h"
+
+// ============================================================================
+// ANIM CLIPS - Pre-rendered OLED sequences played from flash
+// ============================================================================
+// Sequences too elaborate to build from U8g2 primitives every frame are drawn
+// offline and converted with tools/png2clip.py. A clip is a run of frame
+// records, each a keyframe (whole page buffer) or an XOR delta against the
+// previous frame, RLE packed:
+//
+//   [flags][len lo][len hi][payload]    flags bit 0 = keyframe
+//   payload: 0x00..0x7F = n+1 literal bytes, 0x80..0xFF = next byte x (n-0x7E)
+//
+// ClipDecoder unpacks straight into the U8g2 buffer (SH1106 page layout, so
+// no conversion). Delta frames need the previous frame in that buffer, so the
+// decoder remembers which frame the buffer holds and seeks through the frame
+// headers (from the closest keyframe) when frames are skipped or the clip
+// loops.
+
+enum ClipId : uint8_t {
+  CLIP_NONE,
+  CLIP_BOOT,          // eyes open from a line, one blink
+  CLIP_COUNT
+};
+
+struct AnimClip {
+  ClipId id;
+  const char* name;
+  const uint8_t* data;
+  uint32_t size;
+  uint16_t frames;
+  uint8_t fps;
+  bool loop;
+};
+
+static const AnimClip ANIM_CLIPS[CLIP_COUNT] = {
+  { CLIP_NONE, "none", nullptr,        0,                     0,               0,              false },
+  { CLIP_BOOT, "boot", CLIP_BOOT_DATA, sizeof(CLIP_BOOT_DATA), CLIP_BOOT_FRAMES, CLIP_BOOT_FPS, false },
+};
+
+struct ClipStats {
+  uint32_t framesShown = 0;    // decode() calls that produced a frame
+  uint32_t framesDecoded = 0;  // frame records unpacked (includes seeking)
+  uint32_t bytesRead = 0;      // compressed bytes read from flash
+  uint32_t decodeUs = 0;       // last decode() call
+  uint32_t decodeUsMax = 0;
+  uint32_t decodeUsTotal = 0;
+};
+
+class ClipDecoder {
+public:
+  static const uint16_t FRAME_BYTES = 1024;
+
+  // Bring buf to frame `index` of clip. buf must still hold what the last
+  // decode() left there, otherwise call invalidate() first.
+  void decode(uint8_t* buf, const AnimClip& clip, uint16_t index) {
+    uint32_t start = micros();
+    if (index >= clip.frames) index = clip.frames - 1;
+    if (clip_ != &clip || index < frame_ || frame_ < 0) {
+      clip_ = &clip;
+      frame_ = -1;
+      pos_ = 0;
+    }
+
+    // Skip to the last keyframe at or before the target if that's ahead of us
+    uint32_t pos = pos_, keyPos = 0;
+    int16_t keyFrame = -1;
+    for (int16_t i = frame_ + 1; i <= index; i++) {
+      if (clip.data[pos] & KEYFRAME) {
+        keyFrame = i;
+        keyPos = pos;
+      }
+      pos += HEADER_BYTES + recordLen(clip.data + pos);
+    }
+    if (keyFrame > frame_) {
+      frame_ = keyFrame - 1;
+      pos_ = keyPos;
+    }
+
+    while (frame_ < (int16_t)index) {
+      const uint8_t* rec = clip.data + pos_;
+      uint16_t len = recordLen(rec);
+      unpack(buf, rec + HEADER_BYTES, len, rec[0] & KEYFRAME);
+      pos_ += HEADER_BYTES + len;
+      frame_++;
+      stats_.framesDecoded++;
+      stats_.bytesRead += HEADER_BYTES + len;
+    }
+
+    uint32_t us = micros() - start;
+    stats_.framesShown++;
+    stats_.decodeUs = us;
+    stats_.decodeUsTotal += us;
+    if (us > stats_.decodeUsMax) stats_.decodeUsMax = us;
+  }
+
+  // The buffer was drawn over; the next decode() starts from a keyframe
+  void invalidate() { frame_ = -1; }
+
+  const ClipStats& stats() const { return stats_; }
+  void resetStats() { stats_ = ClipStats(); }
+
+private:
+  static const uint8_t KEYFRAME = 0x01;
+  static const uint8_t HEADER_BYTES = 3;
+
+  const AnimClip* clip_ = nullptr;
+  int16_t frame_ = -1;        // frame currently in the buffer, -1 = none
+  uint32_t pos_ = 0;          // offset of frame_ + 1's record
+  ClipStats stats_;
+
+  static uint16_t recordLen(const uint8_t* rec) {
+    return rec[1] | (rec[2] << 8);
+  }
+
+  // RLE into the buffer; keyframes overwrite, deltas XOR (zero runs skip)
+  static void unpack(uint8_t* buf, const uint8_t* src, uint16_t len, bool key) {
+    const uint8_t* end = src + len;
+    uint16_t out = 0;
+    while (src < end && out < FRAME_BYTES) {
+      uint8_t c = *src++;
+      if (c < 0x80) {
+        uint16_t n = min<uint16_t>(c + 1, FRAME_BYTES - out);
+        if (key) {
+          memcpy(buf + out, src, n);
+        } else {
+          for (uint16_t i = 0; i < n; i++) buf[out + i] ^= src[i];
+        }
+        src += c + 1;
+        out += n;
+      } else {
+        uint16_t n = min<uint16_t>(c - 0x7E, FRAME_BYTES - out);
+        uint8_t v = *src++;
+        if (key) {
+          memset(buf + out, v, n);
+        } else if (v) {
+          for (uint16_t i = 0; i < n; i++) buf[out + i] ^= v;
+        }
+        out += n;
+      }
+    }
+  }
+};
+
+#endif
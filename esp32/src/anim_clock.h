@@ -0,0 +1,105 @@
+#ifndef ANIM_CLOCK_H
+#define ANIM_CLOCK_H
+
+#include <Arduino.h>
+#include <math.h>
+
+// ============================================================================
+// ANIMATION CLOCK - Fixed-timestep integration shared by eyes, LEDs and servo
+// ============================================================================
+// loop() speed swings a lot (WiFi down = fast spin, MP3 decode = slow), so
+// nothing animated may step "per call". Wall time is fed into an accumulator
+// and drained in fixed ticks; every animated parameter is integrated once per
+// tick. Rendering runs at its own (lower) rate and interpolates between the
+// last two ticks with alpha(), so render FPS can be lowered without changing
+// how the motion looks.
+//
+// Frame-skip policy: if the loop stalls for longer than maxCatchUp ticks, the
+// excess time is dropped (animations pause briefly) instead of replaying a
+// burst of ticks that would stall the loop even further.
+
+struct AnimClockStats {
+  uint32_t ticks = 0;          // fixed ticks integrated
+  uint32_t droppedTicks = 0;   // ticks discarded by the frame-skip policy
+  uint32_t overruns = 0;       // advance() calls that hit the catch-up cap
+  uint32_t frames = 0;         // renders granted by renderDue()
+};
+
+class AnimClock {
+public:
+  void begin(float tickHz, float renderFps, uint8_t maxCatchUp) {
+    setTickRate(tickHz);
+    setRenderRate(renderFps);
+    maxCatchUp_ = maxCatchUp > 0 ? maxCatchUp : 1;
+    lastUs_ = micros();
+    lastRenderUs_ = lastUs_;
+    accumUs_ = 0;
+    Serial.printf("[CLOCK] Tick %.0f Hz, render %.0f FPS, catch-up %d ticks\n",
+                  tickHz, renderFps, maxCatchUp_);
+  }
+
+  void setTickRate(float hz) {
+    if (hz < 1.0f) hz = 1.0f;
+    tickUs_ = (uint32_t)(1000000.0f / hz);
+    tickDt_ = tickUs_ / 1000000.0f;
+  }
+
+  void setRenderRate(float fps) {
+    if (fps < 1.0f) fps = 1.0f;
+    renderUs_ = (uint32_t)(1000000.0f / fps);
+  }
+
+  // Feed wall time, returns how many fixed ticks to integrate this pass
+  uint8_t advance(unsigned long nowUs) {
+    accumUs_ += (uint32_t)(nowUs - lastUs_);
+    lastUs_ = nowUs;
+
+    uint32_t due = accumUs_ / tickUs_;
+    if (due > maxCatchUp_) {
+      stats_.overruns++;
+      stats_.droppedTicks += due - maxCatchUp_;
+      accumUs_ -= (due - maxCatchUp_) * tickUs_;
+      due = maxCatchUp_;
+    }
+    accumUs_ -= due * tickUs_;
+    stats_.ticks += due;
+    return (uint8_t)due;
+  }
+
+  // Fraction of a tick elapsed since the last integrated tick [0, 1)
+  float alpha() const { return (float)accumUs_ / (float)tickUs_; }
+
+  float tickDt() const { return tickDt_; }
+  uint32_t tickUs() const { return tickUs_; }
+
+  // True at most once per render period
+  bool renderDue(unsigned long nowUs) {
+    if ((uint32_t)(nowUs - lastRenderUs_) < renderUs_) return false;
+    // Keep cadence, but never try to "catch up" missed frames
+    lastRenderUs_ += renderUs_;
+    if ((uint32_t)(nowUs - lastRenderUs_) >= renderUs_) lastRenderUs_ = nowUs;
+    stats_.frames++;
+    return true;
+  }
+
+  const AnimClockStats& stats() const { return stats_; }
+
+private:
+  uint32_t tickUs_ = 16667;
+  float tickDt_ = 0.016667f;
+  uint32_t renderUs_ = 33333;
+  uint8_t maxCatchUp_ = 4;
+  unsigned long lastUs_ = 0;
+  unsigned long lastRenderUs_ = 0;
+  uint32_t accumUs_ = 0;
+  AnimClockStats stats_;
+};
+
+// Convert a "fraction per step" smoothing factor tuned at refHz into the
+// equivalent factor for a step of dt seconds, so exponential followers
+// converge at the same real-time rate whatever the tick rate is.
+inline float smoothingForStep(float perStep, float refHz, float dt) {
+  return 1.0f - powf(1.0f - perStep, dt * refHz);
+}
+
+#endif
@@ -121,6 +121,15 @@ public:
         return isPlaying && mp3 && mp3->isRunning(); 
     }
 
+    // Playback position in permille of the stream, -1 if the server sent no
+    // length. Runs up to the 2 KB prefetch buffer ahead of what is audible.
+    int16_t getProgressPermille() {
+        if (!getIsPlaying() || !audioSource) return -1;
+        uint32_t size = audioSource->getSize();
+        if (size == 0 || size == 0xFFFFFFFF) return -1;
+        return (int16_t)min<uint64_t>(1000, (uint64_t)audioSource->getPos() * 1000 / size);
+    }
+
     void testAudio() {
         if (!isInitialized) begin();
         
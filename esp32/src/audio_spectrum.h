@@ -0,0 +1,204 @@
+#ifndef AUDIO_SPECTRUM_H
+#define AUDIO_SPECTRUM_H
+
+#include <Arduino.h>
+#include <math.h>
+#include "config.h"
+
+// ============================================================================
+// AUDIO SPECTRUM - Fixed-point FFT of mic blocks into LED-ring bands
+// ============================================================================
+// One block = SPECTRUM_N 16-bit samples (256 at 16 kHz: 16 ms, 62.5 Hz bins).
+// process() runs a Hann window and an in-place radix-2 Q15 FFT (every stage
+// halves, so nothing overflows), then sums the power of bins 2..N/2 into
+// SPECTRUM_BANDS log-spaced bands (~125 Hz .. 8 kHz), one per ring pixel.
+//
+// Quiet blocks are normalized to full scale before the FFT and the shift is
+// taken back out of the band energies (block floating point), so a whisper
+// keeps the same 16-bit resolution as a shout.
+//
+// Band levels are 0..255 over the SPECTRUM_RANGE_DB below full scale, with
+// an instant attack and a linear decay; peaks() holds each band's maximum
+// for SPECTRUM_PEAK_HOLD blocks before it decays too. Both are plain arrays
+// for anyone to read - the ring draws peaks(), the eyes listen to the low
+// levels().
+//
+// The work per block is fixed (no data-dependent loops), so its cost is a
+// constant; PerfBench::spectrum() measures it in cycles against
+// SPECTRUM_BUDGET_CYCLES. At run time a block that overran the budget (the
+// task was preempted mid-block, say) makes the next block be dropped, so the
+// average stays inside it either way. Overruns are logged once per episode
+// and counted in stats(), which goes out with the "quality" telemetry.
+
+struct SpectrumStats {
+  uint32_t blocks = 0;          // blocks analysed
+  uint32_t dropped = 0;         // blocks skipped after an overrun
+  uint32_t overruns = 0;        // blocks over SPECTRUM_BUDGET_CYCLES
+  uint32_t cyclesLast = 0;
+  uint32_t cyclesMax = 0;
+};
+
+class AudioSpectrum {
+public:
+  static const uint16_t N = SPECTRUM_N;
+  static const uint8_t BANDS = SPECTRUM_BANDS;
+  static const uint8_t FIRST_BIN = 2;      // below ~125 Hz is hum and DC
+
+  void begin() {
+    for (uint16_t i = 0; i < N / 2; i++) {
+      float a = 2.0f * PI * i / N;
+      cos_[i] = (int16_t)lroundf(cosf(a) * 32767.0f);
+      sin_[i] = (int16_t)lroundf(sinf(a) * 32767.0f);
+    }
+    for (uint16_t i = 0; i < N; i++) {
+      window_[i] = (int16_t)lroundf((0.5f - 0.5f * cosf(2.0f * PI * i / N)) * 32767.0f);
+    }
+    // Log-spaced band edges, at least one bin each
+    const float ratio = (float)(N / 2) / FIRST_BIN;
+    edges_[0] = FIRST_BIN;
+    for (uint8_t b = 1; b <= BANDS; b++) {
+      uint16_t e = (uint16_t)lroundf(FIRST_BIN * powf(ratio, (float)b / BANDS));
+      edges_[b] = max<uint16_t>(e, edges_[b - 1] + 1);
+    }
+    edges_[BANDS] = N / 2;
+    memset(levels_, 0, sizeof(levels_));
+    memset(peaks_, 0, sizeof(peaks_));
+    memset(hold_, 0, sizeof(hold_));
+    ready_ = true;
+  }
+
+  // Analyse one block of N samples. Returns false when the block was
+  // dropped to stay inside the cycle budget.
+  bool process(const int16_t* samples) {
+    if (!ready_) return false;
+    if (skipNext_) {
+      skipNext_ = false;
+      stats_.dropped++;
+      return false;
+    }
+    const uint32_t c0 = ESP.getCycleCount();
+
+    // Block floating point: shift so the loudest sample uses ~15 bits
+    int32_t peak = 1;
+    for (uint16_t i = 0; i < N; i++) peak = max<int32_t>(peak, abs((int32_t)samples[i]));
+    uint8_t shift = 0;
+    while (shift < 15 && (peak << (shift + 1)) < 32768) shift++;
+
+    for (uint16_t i = 0; i < N; i++) {
+      re_[i] = (int16_t)(((int32_t)(samples[i] << shift) * window_[i]) >> 15);
+      im_[i] = 0;
+    }
+    fft();
+
+    for (uint8_t b = 0; b < BANDS; b++) {
+      uint32_t energy = 0;
+      for (uint16_t k = edges_[b]; k < edges_[b + 1]; k++) {
+        energy += ((uint32_t)((int32_t)re_[k] * re_[k]) + (uint32_t)((int32_t)im_[k] * im_[k])) >> ENERGY_SHIFT;
+      }
+      updateBand(b, levelOf(energy, shift));
+    }
+
+    const uint32_t cycles = ESP.getCycleCount() - c0;
+    stats_.blocks++;
+    stats_.cyclesLast = cycles;
+    if (cycles > stats_.cyclesMax) stats_.cyclesMax = cycles;
+    if (cycles > SPECTRUM_BUDGET_CYCLES) {
+      if (!overrun_) {
+        Serial.printf("[SPECTRUM] Block over budget: %lu of %lu cycles, dropping the next\n",
+                      (unsigned long)cycles, (unsigned long)SPECTRUM_BUDGET_CYCLES);
+      }
+      stats_.overruns++;
+      skipNext_ = true;
+    }
+    overrun_ = cycles > SPECTRUM_BUDGET_CYCLES;
+    return true;
+  }
+
+  const uint8_t* levels() const { return levels_; }
+  const uint8_t* peaks() const { return peaks_; }
+
+  // Mean level of bands [first, first + count)
+  uint8_t average(uint8_t first, uint8_t count) const {
+    uint16_t sum = 0;
+    for (uint8_t b = first; b < first + count && b < BANDS; b++) sum += levels_[b];
+    return count ? sum / count : 0;
+  }
+
+  uint16_t bandLowHz(uint8_t b) const { return (uint32_t)edges_[b] * MIC_SAMPLE_RATE / N; }
+  const SpectrumStats& stats() const { return stats_; }
+
+private:
+  static const uint8_t ENERGY_SHIFT = 6;   // a band may sum up to 64 bins
+
+  int16_t re_[N], im_[N];
+  int16_t cos_[N / 2], sin_[N / 2];
+  int16_t window_[N];
+  uint16_t edges_[BANDS + 1];
+  uint8_t levels_[BANDS];
+  uint8_t peaks_[BANDS];
+  uint8_t hold_[BANDS];
+  bool ready_ = false;
+  bool skipNext_ = false;
+  bool overrun_ = false;                   // last analysed block was over budget
+  SpectrumStats stats_;
+
+  // In-place decimation-in-time FFT, each stage scaled by 1/2 (output X/N)
+  void fft() {
+    for (uint16_t i = 1, j = 0; i < N; i++) {
+      uint16_t bit = N >> 1;
+      for (; j & bit; bit >>= 1) j ^= bit;
+      j |= bit;
+      if (i < j) {
+        int16_t t = re_[i]; re_[i] = re_[j]; re_[j] = t;
+        t = im_[i]; im_[i] = im_[j]; im_[j] = t;
+      }
+    }
+    for (uint16_t size = 2; size <= N; size <<= 1) {
+      const uint16_t half = size >> 1;
+      const uint16_t step = N / size;
+      for (uint16_t j = 0; j < half; j++) {
+        const int32_t wr = cos_[j * step];
+        const int32_t wi = -sin_[j * step];
+        for (uint16_t a = j; a < N; a += size) {
+          const uint16_t b = a + half;
+          const int32_t tr = (wr * re_[b] - wi * im_[b]) >> 15;
+          const int32_t ti = (wr * im_[b] + wi * re_[b]) >> 15;
+          re_[b] = (re_[a] - tr) >> 1;
+          im_[b] = (im_[a] - ti) >> 1;
+          re_[a] = (re_[a] + tr) >> 1;
+          im_[a] = (im_[a] + ti) >> 1;
+        }
+      }
+    }
+  }
+
+  // Band energy -> 0..255 over SPECTRUM_RANGE_DB below a full-scale sine.
+  // log2 in 1/16 steps from the leading bit plus four mantissa bits.
+  static uint8_t levelOf(uint32_t energy, uint8_t shift) {
+    if (energy == 0) return 0;
+    int16_t msb = 31 - __builtin_clz(energy);
+    int16_t frac = (msb >= 4) ? (energy >> (msb - 4)) & 0x0F : (energy << (4 - msb)) & 0x0F;
+    // Full-scale sine through Hann and /N: |X|^2 ~ 2^26 >> ENERGY_SHIFT
+    int32_t rel = (int32_t)(msb * 16 + frac) - (int32_t)shift * 32 - (26 - ENERGY_SHIFT) * 16;
+    // 1 log2 step of power = 3.01 dB; rel is in 1/16 of that
+    int32_t range = (int32_t)(SPECTRUM_RANGE_DB * 16 * 100 / 301);
+    if (rel <= -range) return 0;
+    if (rel >= 0) return 255;
+    return (uint8_t)((rel + range) * 255 / range);
+  }
+
+  void updateBand(uint8_t b, uint8_t level) {
+    levels_[b] = (level >= levels_[b]) ? level
+                                       : max<int16_t>(level, levels_[b] - SPECTRUM_DECAY);
+    if (level >= peaks_[b]) {
+      peaks_[b] = level;
+      hold_[b] = SPECTRUM_PEAK_HOLD;
+    } else if (hold_[b]) {
+      hold_[b]--;
+    } else {
+      peaks_[b] = max<int16_t>(level, peaks_[b] - SPECTRUM_DECAY);
+    }
+  }
+};
+
+#endif
@@ -3,10 +3,34 @@
 
 #include <Arduino.h>
 
+// Index of each row in BEHAVIORS[]; lets hot paths use O(1) table lookups
+// instead of comparing names.
+enum BehaviorId : uint8_t {
+  BEH_CALM_IDLE,
+  BEH_SLEEPY_IDLE,
+  BEH_HAPPY,
+  BEH_SHY_HAPPY,
+  BEH_SAD,
+  BEH_ANGRY,
+  BEH_SURPRISED,
+  BEH_CONFUSED,
+  BEH_CURIOUS_IDLE,
+  BEH_LISTENING,
+  BEH_THINKING,
+  BEH_SPEAKING,
+  BEH_SLEEPING,
+  BEH_STARTLED,
+  BEH_PLAYFUL_MISCHIEF,
+  BEH_WAKE_UP,
+  BEH_RANDOM_MOVEMENT,
+  BEH_COUNT
+};
+
 struct Behavior {
+  BehaviorId id;
   const char* name;
-  float openness;   // 0.0 (closed) to 1.2 (wide open)
-  float scaleX;     // Width multiplier (0.8 to 1.2)
+  float openness;   // Eye height multiplier (1.0 = 40px)
+  float scaleX;     // Eye width multiplier (1.0 = 28px)
   float topLid;     // 0.0 (open) to 1.0 (closed)
   float bottomLid;  // 0.0 (open) to 1.0 (closed)
   float offsetX;    // -5 to 5 (eye position)
@@ -15,51 +39,61 @@ struct Behavior {
   uint16_t entryTime; // ms to transition in
   uint16_t holdTime;  // ms to hold (0 = infinite)
   uint16_t exitTime;  // ms to transition out
-  const char* ledEffect; 
 };
 
-static const Behavior BEHAVIORS[] = {
+// Eye geometry here is what the OLED actually shows (tuned on the device);
+// eye_expressions.h turns it into pixel targets at compile time. The LED
+// mood, head movement and sound of each behavior are its timeline
+// (timelines.h).
+static constexpr Behavior BEHAVIORS[] = {
   // --- IDLE STATES ---
-  {"calm_idle",       1.0f, 1.0f, 0.0f, 0.0f, 0, 0,    500, 0,    500,  "cyan"},
-  {"sleepy_idle",     0.6f, 1.0f, 0.3f, 0.0f, 0, 3,    1200,0,    1200, "purple"},
+  {BEH_CALM_IDLE,    "calm_idle",       1.0f,  1.0f,  0.0f,  0.0f,  0, 0,    500, 0,    500},
+  {BEH_SLEEPY_IDLE,  "sleepy_idle",     0.5f,  1.0f,  0.40f, 0.0f,  0, 3,    1200,0,    1200},
   
   // --- EMOTIONS (Timings matched to LED Controller) ---
   // Happy: 5000ms hold (was 2500)
-  {"happy",           1.0f, 1.05f, 0.0f, 0.5f, 0, -1,   400, 5000, 500,  "happy"},
+  {BEH_HAPPY,        "happy",           0.95f, 1.07f, 0.0f,  0.45f, 0, -1,   400, 5000, 500},
   
   // Shy Happy: 5000ms hold
-  {"shy_happy",       0.9f, 1.0f, 0.15f, 0.35f, 2, 1,   500, 5000, 500,  "happy"},
+  {BEH_SHY_HAPPY,    "shy_happy",       0.95f, 1.07f, 0.0f,  0.45f, 2, 1,    500, 5000, 500},
   
   // Sad: 8000ms hold (was 3000)
-  {"sad",             0.8f, 0.95f, 0.35f, 0.05f, 0, 4,   800, 8000, 800,  "sad"},
+  {BEH_SAD,          "sad",             0.9f,  0.93f, 0.4f,  0.0f,  0, 4,    800, 8000, 800},
   
   // Angry: 4000ms hold (was 2500)
-  {"angry",           0.9f, 0.9f, 0.4f, 0.0f,  0, 0,    300, 4000, 500,  "angry"},
+  {BEH_ANGRY,        "angry",           0.9f,  0.9f,  0.4f,  0.0f,  0, 0,    300, 4000, 500},
   
   // Surprised: 1500ms hold (Keep short)
-  {"surprised",       1.2f, 0.9f, 0.0f, 0.0f, 0, -3,    150, 1500, 400,  "surprised"},
+  {BEH_SURPRISED,    "surprised",       1.2f,  1.15f, 0.0f,  0.0f,  0, -3,   150, 1500, 400},
   
   // Confused: 3000ms hold
-  {"confused",        1.0f, 1.0f, 0.1f, 0.0f, 3, -1,    500, 3000, 500,  "purple"},
+  {BEH_CONFUSED,     "confused",        0.95f, 1.0f,  0.2f,  0.0f,  3, -1,   500, 3000, 500},
   
   // Curious: 4000ms hold (0 means infinite, but we want it to timeout if triggered by sensor)
-  {"curious_idle",    1.05f, 1.0f, 0.0f, 0.0f, 4, -2,   400, 4000, 400,  "cyan"},
+  {BEH_CURIOUS_IDLE, "curious_idle",    1.05f, 1.07f, 0.0f,  0.0f,  4, -2,   400, 4000, 400},
 
   // --- FUNCTIONAL STATES ---
-  {"listening",       1.1f, 1.0f, 0.0f, 0.0f, 0, 0,    300, 0,    300,  "listening"},
-  {"thinking",        1.0f, 1.0f, 0.1f, 0.0f, -8,-8,   400, 0,    400,  "purple"},
-  {"speaking",        1.0f, 1.0f, 0.0f, 0.0f, 0, 0,    200, 0,    200,  "cyan"},
-  {"sleeping",        0.1f, 1.0f, 0.45f, 0.45f, 0, 8,   2500,0,    2500, "sleeping"},
-  {"startled",        1.3f, 0.85f, 0.0f, 0.0f, 0, -4,   100, 1500, 300,  "surprised"},
-  {"playful_mischief", 1.0f, 1.0f, 0.0f, 0.3f, 6, 0,   300, 3000, 400,  "happy"},
+  {BEH_LISTENING,    "listening",       1.1f,  1.07f, 0.0f,  0.0f,  0, 0,    300, 0,    300},
+  {BEH_THINKING,     "thinking",        0.95f, 1.0f,  0.0f,  0.3f,  -8,-8,   400, 0,    400},
+  {BEH_SPEAKING,     "speaking",        1.0f,  1.0f,  0.0f,  0.0f,  0, 0,    200, 0,    200},
+  {BEH_SLEEPING,     "sleeping",        0.15f, 1.0f,  0.45f, 0.45f, 0, 8,    2500,0,    2500},
+  {BEH_STARTLED,     "startled",        1.2f,  1.15f, 0.0f,  0.0f,  0, -4,   100, 1500, 300},
+  {BEH_PLAYFUL_MISCHIEF, "playful_mischief", 0.9f, 1.0f, 0.0f, 0.3f, 6, 0,   300, 3000, 400},
   
   // --- WAKE UP BEHAVIORS ---
-  {"wake_up",         1.1f, 1.0f, 0.0f, 0.0f, 0, -2,   300, 2000, 400,  "cyan"},
-  {"random_movement", 1.0f, 1.0f, 0.1f, 0.0f, 0, 0,    200, 25000, 300, "happy"},
+  {BEH_WAKE_UP,      "wake_up",         1.1f,  1.0f,  0.0f,  0.0f,  0, -2,   300, 2000, 400},
+  {BEH_RANDOM_MOVEMENT, "random_movement", 1.0f, 1.0f, 0.1f, 0.0f, 0, 0,     200, 25000, 300},
   
-  {nullptr, 0,0,0,0,0,0, 0,0,0, nullptr}
+  {BEH_COUNT, nullptr, 0,0,0,0,0,0, 0,0,0}
 };
 
+// Compile-time check that every row sits at the index of its id
+constexpr bool behaviorIdsInOrder(int i) {
+  return BEHAVIORS[i].name == nullptr ? (i == BEH_COUNT)
+                                      : (BEHAVIORS[i].id == i && behaviorIdsInOrder(i + 1));
+}
+static_assert(behaviorIdsInOrder(0), "BEHAVIORS[] rows must be in BehaviorId order");
+
 inline const Behavior* findBehavior(const char* name) {
   for (int i = 0; BEHAVIORS[i].name != nullptr; i++) {
     if (strcmp(BEHAVIORS[i].name, name) == 0) return &BEHAVIORS[i];
@@ -67,4 +101,8 @@ inline const Behavior* findBehavior(const char* name) {
   return &BEHAVIORS[0]; // Default to calm_idle
 }
 
-#endif
\ No newline at end of file
+inline const Behavior* getBehavior(BehaviorId id) {
+  return (id < BEH_COUNT) ? &BEHAVIORS[id] : &BEHAVIORS[0];
+}
+
+#endif
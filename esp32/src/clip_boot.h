@@ -0,0 +1,101 @@
+#ifndef CLIP_BOOT_H
+#define CLIP_BOOT_H
+
+#include <Arduino.h>
+
+// Generated by tools/png2clip.py from boot_000.png .. boot_023.png - do not edit.
+// 24 frames @ 20 fps, 14 keyframes, 1390 bytes (24576 raw, 1158 B/s from flash)
+
+static const uint16_t CLIP_BOOT_FRAMES = 24;
+static const uint8_t CLIP_BOOT_FPS = 20;
+static const uint8_t CLIP_BOOT_DATA[] = {
+  0x01, 0x1e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x99, 0x00, 0x82, 0x80, 0xba, 0x00, 0x82,
+  0x80, 0xba, 0x00, 0x82, 0x01, 0xba, 0x00, 0x82, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x99,
+  0x00, 0x01, 0x1e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x95, 0x00, 0x8a, 0x80, 0xb2, 0x00,
+  0x8a, 0x80, 0xb2, 0x00, 0x8a, 0x01, 0xb2, 0x00, 0x8a, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0x95, 0x00, 0x01, 0x1e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x91, 0x00, 0x92, 0x80, 0xaa,
+  0x00, 0x92, 0x80, 0xaa, 0x00, 0x92, 0x01, 0xaa, 0x00, 0x92, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0x91, 0x00, 0x01, 0x1e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8d, 0x00, 0x9a, 0x80,
+  0xa2, 0x00, 0x9a, 0x80, 0xa2, 0x00, 0x9a, 0x01, 0xa2, 0x00, 0x9a, 0x01, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0x8d, 0x00, 0x01, 0x46, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8d, 0x00, 0x01,
+  0xc0, 0xf0, 0x80, 0xf8, 0x92, 0xfc, 0x80, 0xf8, 0x01, 0xf0, 0xc0, 0xa2, 0x00, 0x01, 0xc0, 0xf0,
+  0x80, 0xf8, 0x92, 0xfc, 0x80, 0xf8, 0x01, 0xf0, 0xc0, 0xa2, 0x00, 0x01, 0x03, 0x0f, 0x80, 0x1f,
+  0x92, 0x3f, 0x80, 0x1f, 0x01, 0x0f, 0x03, 0xa2, 0x00, 0x01, 0x03, 0x0f, 0x80, 0x1f, 0x92, 0x3f,
+  0x80, 0x1f, 0x01, 0x0f, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8d, 0x00, 0x01, 0x5a, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0x92, 0x00, 0x80, 0x80, 0x8e, 0xc0, 0x80, 0x80, 0xaa, 0x00, 0x80, 0x80,
+  0x8e, 0xc0, 0x80, 0x80, 0xa6, 0x00, 0x01, 0xf0, 0xfc, 0x96, 0xff, 0x01, 0xfc, 0xf0, 0xa2, 0x00,
+  0x01, 0xf0, 0xfc, 0x96, 0xff, 0x01, 0xfc, 0xf0, 0xa2, 0x00, 0x01, 0x1f, 0x7f, 0x96, 0xff, 0x01,
+  0x7f, 0x1f, 0xa2, 0x00, 0x01, 0x1f, 0x7f, 0x96, 0xff, 0x01, 0x7f, 0x1f, 0xa4, 0x00, 0x80, 0x01,
+  0x80, 0x03, 0x8e, 0x07, 0x80, 0x03, 0x80, 0x01, 0xa6, 0x00, 0x80, 0x01, 0x80, 0x03, 0x8e, 0x07,
+  0x80, 0x03, 0x80, 0x01, 0xff, 0x00, 0xff, 0x00, 0x90, 0x00, 0x01, 0x62, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0x8f, 0x00, 0x00, 0x80, 0x80, 0xe0, 0x80, 0xf0, 0x8e, 0xf8, 0x80, 0xf0, 0x80, 0xe0, 0x00,
+  0x80, 0xa4, 0x00, 0x00, 0x80, 0x80, 0xe0, 0x80, 0xf0, 0x8e, 0xf8, 0x80, 0xf0, 0x80, 0xe0, 0x00,
+  0x80, 0xa3, 0x00, 0x00, 0xfe, 0x98, 0xff, 0x00, 0xfe, 0xa2, 0x00, 0x00, 0xfe, 0x98, 0xff, 0x00,
+  0xfe, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa3, 0x00, 0x00, 0x03, 0x80, 0x0f, 0x80,
+  0x1f, 0x8e, 0x3f, 0x80, 0x1f, 0x80, 0x0f, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x03, 0x80, 0x0f, 0x80,
+  0x1f, 0x8e, 0x3f, 0x80, 0x1f, 0x80, 0x0f, 0x00, 0x03, 0xff, 0x00, 0xff, 0x00, 0x8f, 0x00, 0x01,
+  0x62, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8e, 0x00, 0x01, 0xc0, 0xf0, 0x80, 0xfc, 0x80, 0xfe, 0x8e,
+  0xff, 0x80, 0xfe, 0x80, 0xfc, 0x01, 0xf0, 0xc0, 0xa2, 0x00, 0x01, 0xc0, 0xf0, 0x80, 0xfc, 0x80,
+  0xfe, 0x8e, 0xff, 0x80, 0xfe, 0x80, 0xfc, 0x01, 0xf0, 0xc0, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00,
+  0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x01, 0x03, 0x0f, 0x80,
+  0x3f, 0x80, 0x7f, 0x8e, 0xff, 0x80, 0x7f, 0x80, 0x3f, 0x01, 0x0f, 0x03, 0xa2, 0x00, 0x01, 0x03,
+  0x0f, 0x80, 0x3f, 0x80, 0x7f, 0x8e, 0xff, 0x80, 0x7f, 0x80, 0x3f, 0x01, 0x0f, 0x03, 0xff, 0x00,
+  0xff, 0x00, 0x8e, 0x00, 0x01, 0x5e, 0x00, 0xff, 0x00, 0x95, 0x00, 0x8e, 0x80, 0xae, 0x00, 0x8e,
+  0x80, 0xa8, 0x00, 0x01, 0xe0, 0xf8, 0x80, 0xfe, 0x92, 0xff, 0x80, 0xfe, 0x01, 0xf8, 0xe0, 0xa2,
+  0x00, 0x01, 0xe0, 0xf8, 0x80, 0xfe, 0x92, 0xff, 0x80, 0xfe, 0x01, 0xf8, 0xe0, 0xa2, 0x00, 0x9a,
+  0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x01,
+  0x0f, 0x3f, 0x96, 0xff, 0x01, 0x3f, 0x0f, 0xa2, 0x00, 0x01, 0x0f, 0x3f, 0x96, 0xff, 0x01, 0x3f,
+  0x0f, 0xa6, 0x00, 0x80, 0x01, 0x8e, 0x03, 0x80, 0x01, 0xaa, 0x00, 0x80, 0x01, 0x8e, 0x03, 0x80,
+  0x01, 0xff, 0x00, 0x93, 0x00, 0x00, 0x6a, 0x00, 0xff, 0x00, 0x91, 0x00, 0x80, 0x80, 0x80, 0xc0,
+  0x8e, 0x60, 0x80, 0xc0, 0x80, 0x80, 0xa6, 0x00, 0x80, 0x80, 0x80, 0xc0, 0x8e, 0x60, 0x80, 0xc0,
+  0x80, 0x80, 0xa4, 0x00, 0x01, 0x18, 0x06, 0x80, 0x01, 0x92, 0x00, 0x80, 0x01, 0x01, 0x06, 0x18,
+  0xa2, 0x00, 0x01, 0x18, 0x06, 0x80, 0x01, 0x92, 0x00, 0x80, 0x01, 0x01, 0x06, 0x18, 0xff, 0x00,
+  0xff, 0x00, 0xa0, 0x00, 0x01, 0x10, 0x40, 0x96, 0x00, 0x01, 0x40, 0x10, 0xa2, 0x00, 0x01, 0x10,
+  0x40, 0x96, 0x00, 0x01, 0x40, 0x10, 0xa4, 0x00, 0x80, 0x01, 0x80, 0x02, 0x8e, 0x04, 0x80, 0x02,
+  0x80, 0x01, 0xa6, 0x00, 0x80, 0x01, 0x80, 0x02, 0x8e, 0x04, 0x80, 0x02, 0x80, 0x01, 0xff, 0x00,
+  0x91, 0x00, 0x00, 0x3a, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8b,
+  0x00, 0x01, 0x20, 0x80, 0x96, 0x00, 0x01, 0x80, 0x20, 0xa2, 0x00, 0x01, 0x20, 0x80, 0x96, 0x00,
+  0x01, 0x80, 0x20, 0xa4, 0x00, 0x80, 0x02, 0x80, 0x04, 0x8e, 0x08, 0x80, 0x04, 0x80, 0x02, 0xa6,
+  0x00, 0x80, 0x02, 0x80, 0x04, 0x8e, 0x08, 0x80, 0x04, 0x80, 0x02, 0xff, 0x00, 0x91, 0x00, 0x00,
+  0x3a, 0x00, 0xff, 0x00, 0x91, 0x00, 0x80, 0x40, 0x80, 0x20, 0x8e, 0x10, 0x80, 0x20, 0x80, 0x40,
+  0xa6, 0x00, 0x80, 0x40, 0x80, 0x20, 0x8e, 0x10, 0x80, 0x20, 0x80, 0x40, 0xa4, 0x00, 0x01, 0x04,
+  0x01, 0x96, 0x00, 0x01, 0x01, 0x04, 0xa2, 0x00, 0x01, 0x04, 0x01, 0x96, 0x00, 0x01, 0x01, 0x04,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8b, 0x00, 0x01, 0x66, 0x00, 0xff,
+  0x00, 0x91, 0x00, 0x80, 0xc0, 0x80, 0xe0, 0x8e, 0xf0, 0x80, 0xe0, 0x80, 0xc0, 0xa6, 0x00, 0x80,
+  0xc0, 0x80, 0xe0, 0x8e, 0xf0, 0x80, 0xe0, 0x80, 0xc0, 0xa4, 0x00, 0x00, 0xfc, 0x98, 0xff, 0x00,
+  0xfc, 0xa2, 0x00, 0x00, 0xfc, 0x98, 0xff, 0x00, 0xfc, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a,
+  0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x00, 0x3f, 0x98, 0xff, 0x00,
+  0x3f, 0xa2, 0x00, 0x00, 0x3f, 0x98, 0xff, 0x00, 0x3f, 0xa4, 0x00, 0x80, 0x03, 0x80, 0x07, 0x8e,
+  0x0f, 0x80, 0x07, 0x80, 0x03, 0xa6, 0x00, 0x80, 0x03, 0x80, 0x07, 0x8e, 0x0f, 0x80, 0x07, 0x80,
+  0x03, 0xff, 0x00, 0x91, 0x00, 0x00, 0x10, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf7, 0x00, 0x00, 0x10, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf7, 0x00, 0x00, 0x10, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf7, 0x00, 0x00, 0x10,
+  0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf7,
+  0x00, 0x00, 0x10, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xf7, 0x00, 0x01, 0x52, 0x00, 0xff, 0x00, 0xff, 0x00, 0x92, 0x00, 0x80, 0x80, 0x8e,
+  0xc0, 0x80, 0x80, 0xaa, 0x00, 0x80, 0x80, 0x8e, 0xc0, 0x80, 0x80, 0xa6, 0x00, 0x01, 0xf0, 0xfc,
+  0x96, 0xff, 0x01, 0xfc, 0xf0, 0xa2, 0x00, 0x01, 0xf0, 0xfc, 0x96, 0xff, 0x01, 0xfc, 0xf0, 0xa2,
+  0x00, 0x01, 0x0f, 0x3f, 0x96, 0xff, 0x01, 0x3f, 0x0f, 0xa2, 0x00, 0x01, 0x0f, 0x3f, 0x96, 0xff,
+  0x01, 0x3f, 0x0f, 0xa6, 0x00, 0x80, 0x01, 0x8e, 0x03, 0x80, 0x01, 0xaa, 0x00, 0x80, 0x01, 0x8e,
+  0x03, 0x80, 0x01, 0xff, 0x00, 0xff, 0x00, 0x92, 0x00, 0x01, 0x2e, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0x8d, 0x00, 0x00, 0x80, 0x98, 0xc0, 0x00, 0x80, 0xa2, 0x00, 0x00, 0x80, 0x98, 0xc0,
+  0x00, 0x80, 0xa2, 0x00, 0x00, 0x01, 0x98, 0x03, 0x00, 0x01, 0xa2, 0x00, 0x00, 0x01, 0x98, 0x03,
+  0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x8d, 0x00, 0x01, 0x52, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0x92, 0x00, 0x80, 0x80, 0x8e, 0xc0, 0x80, 0x80, 0xaa, 0x00, 0x80, 0x80, 0x8e, 0xc0, 0x80,
+  0x80, 0xa6, 0x00, 0x01, 0xf0, 0xfc, 0x96, 0xff, 0x01, 0xfc, 0xf0, 0xa2, 0x00, 0x01, 0xf0, 0xfc,
+  0x96, 0xff, 0x01, 0xfc, 0xf0, 0xa2, 0x00, 0x01, 0x0f, 0x3f, 0x96, 0xff, 0x01, 0x3f, 0x0f, 0xa2,
+  0x00, 0x01, 0x0f, 0x3f, 0x96, 0xff, 0x01, 0x3f, 0x0f, 0xa6, 0x00, 0x80, 0x01, 0x8e, 0x03, 0x80,
+  0x01, 0xaa, 0x00, 0x80, 0x01, 0x8e, 0x03, 0x80, 0x01, 0xff, 0x00, 0xff, 0x00, 0x92, 0x00, 0x01,
+  0x66, 0x00, 0xff, 0x00, 0x91, 0x00, 0x80, 0xc0, 0x80, 0xe0, 0x8e, 0xf0, 0x80, 0xe0, 0x80, 0xc0,
+  0xa6, 0x00, 0x80, 0xc0, 0x80, 0xe0, 0x8e, 0xf0, 0x80, 0xe0, 0x80, 0xc0, 0xa4, 0x00, 0x00, 0xfc,
+  0x98, 0xff, 0x00, 0xfc, 0xa2, 0x00, 0x00, 0xfc, 0x98, 0xff, 0x00, 0xfc, 0xa2, 0x00, 0x9a, 0xff,
+  0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x9a, 0xff, 0xa2, 0x00, 0x00, 0x3f,
+  0x98, 0xff, 0x00, 0x3f, 0xa2, 0x00, 0x00, 0x3f, 0x98, 0xff, 0x00, 0x3f, 0xa4, 0x00, 0x80, 0x03,
+  0x80, 0x07, 0x8e, 0x0f, 0x80, 0x07, 0x80, 0x03, 0xa6, 0x00, 0x80, 0x03, 0x80, 0x07, 0x8e, 0x0f,
+  0x80, 0x07, 0x80, 0x03, 0xff, 0x00, 0x91, 0x00, 0x00, 0x10, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf7, 0x00, 0x00, 0x10, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf7, 0x00,
+};
+
+#endif
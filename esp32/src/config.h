@@ -31,7 +31,115 @@
 #define AUDIO_ENABLED true           
 #define AUDIO_VOLUME 18
 
+// ANIMATION TIMING
+#define ANIM_TICK_HZ          60     // Fixed integration rate for eyes/LEDs/timelines
+#define RENDER_FPS            30     // OLED + LED output rate (interpolated)
+#define ANIM_MAX_CATCHUP_TICKS 4     // Ticks replayed after a stall before dropping time
+
+// RENDER TASK (OLED rasterize + I2C transfer off the main loop)
+#define RENDER_TASK_CORE      0      // loop() runs on core 1
+#define RENDER_TASK_PRIORITY  1      // Below WiFi/lwIP, same as loopTask
+#define RENDER_TASK_STACK     4096
+
+// OLED BUS (SH1106 on the I2C pins from pins.h)
+#define OLED_ASYNC_I2C        true   // Queue frames to a transport task (false = blocking U8g2/Wire)
+#define OLED_I2C_PORT         1      // IDF port for the OLED (async only). Wire is not started in
+                                     // async mode; the OLED pins carry no other bus.
+#define OLED_I2C_HZ           400000
+#define OLED_BUS_STAGE_BYTES  2048   // Per staging buffer; a full frame is ~1.3 KB
+#define OLED_BUS_TASK_CORE    0
+#define OLED_BUS_TASK_PRIORITY 2     // Above the render task so the bus never idles
+#define OLED_BUS_TASK_STACK   2048
+#define OLED_PAGE_BUFFER      false  // 128 B page buffer instead of 1 KB full buffer: frees ~7 KB
+                                     // (no tile diff, shape/glyph caches or clips). With
+                                     // OLED_ASYNC_I2C the staging buffers cost 2x OLED_BUS_STAGE_BYTES.
+
+// OLED MIRROR (real framebuffer to the dashboard as binary websocket frames)
+#define OLED_MIRROR           true   // Full buffer only; ~2.4 KB RAM (shadow + packet)
+#define OLED_MIRROR_FPS       10     // Max packets per second
+#define OLED_MIRROR_MAX_BPS   3000   // Byte budget (token bucket), well clear of MP3 streaming
+#define OLED_MIRROR_KEYFRAME_EVERY 50 // Packets between keyframes, bounds loss recovery
+
+// FRAME GOVERNOR (quality steps down when loop() sections overrun)
+#define GOVERNOR_LOOP_BUDGET_US  10000 // render + audio + ws + LED time per loop() pass
+#define GOVERNOR_WINDOW_MS       500   // Judged once per window
+#define GOVERNOR_OVER_PCT        10    // Step down if more passes than this are over budget
+#define GOVERNOR_RECOVER_WINDOWS 6     // Calm windows in a row before stepping back up
+#define GOVERNOR_TELEMETRY_MS    5000  // "quality" websocket report interval
+
+// SUBTITLES (play_audio text as a marquee on the bottom row)
+#define SUBTITLE_ENABLED      true
+#define SUBTITLE_MAX_CHARS    96     // Longer text is cut; strip RAM is 5 B per char
+#define SUBTITLE_MS_PER_CHAR  65     // Pace when the MP3 length is unknown (~15 chars/s speech)
+
+// LED RING
+#define LED_GAMMA             2.2f   // Applied to each mood's breath curve when its level table is built
+#define LED_STATS_MS          30000  // "[LED] shows/skipped" Serial line interval
+#define LED_MAX_BRIGHTNESS    255    // Global scale applied when pixels are drawn (0..255);
+                                     // the power budget caps the ring's current at any setting
+#define LED_RMT_TASK          true   // Clock frames out from a transport task (false = blocking show())
+#define LED_RMT_CHANNEL       0
+#define LED_TASK_CORE         0
+#define LED_TASK_PRIORITY     1      // Below the OLED transport
+#define LED_TASK_STACK        2048
+#define LED_COMET_TAIL        6      // Pixels
+#define LED_CHASE_GAP         4      // Every Nth pixel lit
+#define LED_SPINNER_ARC       4      // Pixels
+#define LED_SPINNER_FLOOR     20     // Ring glow under the spinner, of 256
+#define LED_VOICE_HOLD_MS     300    // Spectrum stays on the ring this long after the last mic block
+#define LED_OVERLAY_DEPTH     3      // Transient moods (flash, spectrum) stacked over the base mood
+
+// BEHAVIOR TIMELINES (eyes, LEDs, servo and buzzer keyframes on the anim clock)
+#define TIMELINE_MAX_TRACKS   8      // Tracks playing at once, across all timelines
+#define TIMELINE_MAX_BYTES    512    // Largest blob accepted from the websocket
+#define TIMELINE_STATS_MS     30000  // "[TIMELINE] plays/keys/dropped" Serial line interval
+
+// SERVO (minimum-jerk moves, stepped at the servo's own frame rate)
+#define SERVO_TIMER           true   // Step moves from an esp_timer callback (false = from loop())
+#define SERVO_PLANNER_HZ      50     // Planner steps per second = servo PWM frames
+#define SERVO_SPEED_DPS       60     // Peak speed of a move without a set duration, °/s
+#define SERVO_IDLE_SPEED_DPS  25     // Same, for idle glances
+#define SERVO_MIN_MOVE_MS     150    // Shortest planned move
+#define SERVO_STATS_MS        30000  // "[SERVO] writes/steps" Serial line interval
+#define GESTURE_MAX_BYTES     64     // Largest gesture program (flash or upload)
+#define GESTURE_MAX_MS        20000  // Longest gesture run time accepted
+#define GESTURE_OPS_PER_STEP  4      // Interpreter ops per planner step, bounds the step cost
+
+// POWER BUDGET (estimated 5 V draw per load, see power_budget.h)
+#define POWER_BUDGET_MA       1000   // Supply rating less margin
+#define POWER_BASE_MA         250    // ESP32 + WiFi TX bursts + OLED + sensors
+#define POWER_LED_MA_PER_CHANNEL 20  // One WS2812 colour channel at 255
+#define POWER_LED_IDLE_MA     1      // Per pixel, dark
+#define POWER_LED_FLOOR_MA    40     // The ring is never limited below this
+#define POWER_SERVO_START_MA  550    // Spike while a move starts out of rest
+#define POWER_SERVO_START_MS  80
+#define POWER_SERVO_MOVE_MA   220
+#define POWER_SERVO_HOLD_MA   10
+#define POWER_SERVO_DEFER_MS  40     // Longest a start waits for the ring to dim
+#define POWER_AUDIO_MA        200    // MAX98357A while a stream plays
+#define POWER_TELEMETRY_MS    5000   // "power" websocket report interval
+
+// STOPWATCH DISPLAY
+#define STOPWATCH_PRECISION   2      // Digits after seconds: 2 = .cc, 1 = .c, 0 = none.
+                                     // Redraws only when the shown value changes, so
+                                     // this also sets the refresh rate (1/10/RENDER_FPS Hz)
+
 // MEMORY OPTIMIZATION
-#define ENABLE_MICROPHONE false  // Set to true once basic features work
+#define ENABLE_MICROPHONE false  // Set to true once basic features work. Check the
+                                 // [BENCH] spectrum line (ENABLE_PERF_BENCH) fits
+                                 // SPECTRUM_BUDGET_CYCLES on the board first.
+
+// MIC SPECTRUM (ENABLE_MICROPHONE: FFT bands for the LED ring and the eyes)
+#define MIC_SAMPLE_RATE       16000
+#define SPECTRUM_N            256    // FFT points per block (16 ms at 16 kHz), ~2.6 KB RAM
+#define SPECTRUM_BANDS        16     // One per ring pixel
+#define SPECTRUM_RANGE_DB     60     // Band level 0..255 spans this far below full scale
+#define SPECTRUM_DECAY        12     // Level / peak fall per block (255 -> 0 in ~340 ms)
+#define SPECTRUM_PEAK_HOLD    20     // Blocks a band peak is held before it decays
+#define SPECTRUM_BUDGET_CYCLES 240000 // Per block: 1 ms at 240 MHz, 6% of the block time
+#define EYE_VOICE_LIFT_PX     3      // Gaze lift at full voice level
+
+// DIAGNOSTICS
+#define ENABLE_PERF_BENCH false  // Boot-time render/math benchmarks on Serial
 
 #endif // CONFIG_H
\ No newline at end of file
@@ -4,43 +4,101 @@
 #include <U8g2lib.h>
 #include <math.h>
 #include "behaviors.h"
+#include "eye_expressions.h"
+#include "fixed_math.h"
+#include "eye_layers.h"
+#include "tile_flush.h"
+#include "anim_clock.h"
+#include "eye_shape_cache.h"
+#include "particle_system.h"
+#include "stopwatch_view.h"
+#include "oled_bus.h"
+#include "anim_clip.h"
+#include "subtitle_strip.h"
+#include "oled_mirror.h"
+
+// Immutable description of one frame. Built on the main loop by
+// EyeEngine::snapshot() and rasterized by renderFrame(), possibly on the
+// render task, so it must not reference any live engine state.
+struct EyeFrame {
+  EyeParams view;          // interpolated eye state
+  ParticleFrame particles; // effect sprites, already in screen space
+  bool stopwatch = false;
+  int8_t swMin = 0;
+  int8_t swSec = 0;
+  int8_t swCentis = 0;
+  ClipId clip = CLIP_NONE; // pre-rendered clip replacing the eyes
+  uint16_t clipFrame = 0;
+  uint16_t subtitleId = 0;  // 0 = no subtitle
+  int16_t subtitleX = 0;    // strip column at screen x 0
+  char subtitle[SUBTITLE_MAX_CHARS + 1] = {};
+  uint32_t publishedUs = 0; // stamped by RenderTask::publish()
+  uint32_t seq = 0;
+};
+
+// Render paths
+// ------------
+// Full buffer (U8G2_..._F_...): rasterize into the 1 KB U8g2 buffer, then
+// TileFlusher sends the tiles that changed. Eye shapes and stopwatch digits
+// come from pre-rasterized masks, clips decode in place. Subtitles are a
+// window into a pre-rendered strip (subtitle_strip.h) over the bottom page.
+//
+// Page buffer (U8G2_..._1_..., picked at runtime from the display): one
+// 128-byte page at a time. Only pages touched by the eyes / particles /
+// stopwatch (or by the previous frame, to blank them) are drawn and sent,
+// with plain U8g2 primitives; no clips. OLED_PAGE_BUFFER builds also leave
+// out the full-buffer-only helpers (tile shadow, shape masks, stopwatch
+// glyph masks), which is most of the RAM it saves (PerfBench::pageBuffer()).
 
 class EyeEngine {
 public:
-  explicit EyeEngine(U8G2& display) : display_(display) {
+  explicit EyeEngine(U8G2& display)
+    : display_(display)
+#if !OLED_PAGE_BUFFER
+    , flusher_(display)
+#endif
+  {
+    paged_ = display.getBufferTileHeight() < 8;
     randomSeed(analogRead(34));
   }
 
   void startBootSequence() {
-    currentWidth_ = 28;
-    currentHeight_ = 40;
-    targetWidth_ = 28;
-    targetHeight_ = 40;
-    
-    currentOffsetX_ = 0;
-    currentOffsetY_ = 0;
-    targetOffsetX_ = 0;
-    targetOffsetY_ = 0;
-    
-    topLid_ = 0.0f;
-    bottomLid_ = 0.0f;
-    targetTopLid_ = 0.0f;
-    targetBottomLid_ = 0.0f;
-    
-    blinkFactor_ = 1.0f;
-    blinkTimer_ = 0.0f;
-    nextBlink_ = 4.0f;
-    
-    saccadeX_ = 0;
-    saccadeY_ = 0;
+    expr_ = &EYE_EXPRESSIONS[BEH_CALM_IDLE];
+    EyeLayer& base = layers_[LAYER_EXPRESSION];
+    base.value = EyeParams();
+    base.value.width = q16FromInt(expr_->width);
+    base.value.height = q16FromInt(expr_->height);
+    from_ = base.value;
+    to_ = base.value;
+    transitionT_ = Q16_ONE;
+    layers_[LAYER_GAZE].value = EyeParams();
+    layers_[LAYER_BLINK].value = EyeParams();
+    layers_[LAYER_OVERRIDE].weight = 0;
+    fromBlinkW_ = toBlinkW_ = q16FromFloat(expr_->blink);
+    fromGazeW_ = toGazeW_ = q16FromFloat(expr_->gaze);
+    layers_[LAYER_BLINK].weight = fromBlinkW_;
+    layers_[LAYER_GAZE].weight = fromGazeW_;
+    layers_.evaluate(eye_);
+    
+    blinkTimer_ = 0;
+    nextBlink_ = q16(4.0f);
+    
+    saccadeTimer_ = 0;
     targetSaccadeX_ = 0;
     targetSaccadeY_ = 0;
     
     activeEffect_ = EFFECT_NONE;
+    particles_.clear();
+    prev_ = eye_;
+    
+    // Eyes open via the pre-rendered boot clip; the state above is where
+    // its last frame hands over
+    playClip(CLIP_BOOT);
     
     Serial.println("[EYE] Initialized - stable eyes");
     Serial.printf("[EYE] Initial state: w=%.1f h=%.1f topLid=%.2f botLid=%.2f\n",
-                  currentWidth_, currentHeight_, topLid_, bottomLid_);
+                  q16ToFloat(eye_.width), q16ToFloat(eye_.height),
+                  q16ToFloat(eye_.topLid), q16ToFloat(eye_.bottomLid));
   }
 
   void setTarget(const Behavior* b) {
@@ -48,240 +106,298 @@ public:
       Serial.println("[EYE] ERROR: NULL behavior pointer!");
       return;
     }
-    
-    Serial.printf("[EYE] Setting target for: %s\n", b->name);
-    
-    // Reset effect timer
-    effectTimer_ = 0;
-    
-    // Map behavior to eye parameters
-    if (strcmp(b->name, "happy") == 0 || strcmp(b->name, "shy_happy") == 0) {
-      targetWidth_ = 30;
-      targetHeight_ = 38;
-      targetTopLid_ = 0.0f;
-      targetBottomLid_ = 0.45f;  // Smile!
-      activeEffect_ = EFFECT_HEART;
-      Serial.printf("[EYE] HAPPY: Setting bottomLid to 0.45 for smile\n");
-    }
-    else if (strcmp(b->name, "sad") == 0) {
-      targetWidth_ = 26;
-      targetHeight_ = 36;
-      targetTopLid_ = 0.4f;  // Droopy top
-      targetBottomLid_ = 0.0f;
-      activeEffect_ = EFFECT_NONE;
-      Serial.printf("[EYE] SAD: Setting topLid to 0.4 for droop\n");
-    }
-    else if (strcmp(b->name, "surprised") == 0 || strcmp(b->name, "startled") == 0) {
-      targetWidth_ = 32;
-      targetHeight_ = 48;
-      targetTopLid_ = 0.0f;
-      targetBottomLid_ = 0.0f;
-      activeEffect_ = EFFECT_STARS;
-      Serial.printf("[EYE] SURPRISED: Wide open\n");
-    }
-    else if (strcmp(b->name, "curious_idle") == 0) {
-      targetWidth_ = 30;
-      targetHeight_ = 42;
-      targetTopLid_ = 0.0f;
-      targetBottomLid_ = 0.0f;
-      activeEffect_ = EFFECT_SPARKLE;
-      Serial.printf("[EYE] CURIOUS: Alert and sparkly\n");
-    }
-    else if (strcmp(b->name, "sleepy_idle") == 0) {
-      targetWidth_ = 28;
-      targetHeight_ = 20;
-      targetTopLid_ = 0.40f;
-      targetBottomLid_ = 0.0f;
-      activeEffect_ = EFFECT_ZZZ;
-      Serial.printf("[EYE] SLEEPY: Half closed\n");
-    }
-    else if (strcmp(b->name, "sleeping") == 0) {
-      targetWidth_ = 28;
-      targetHeight_ = 6;
-      targetTopLid_ = 0.45f;
-      targetBottomLid_ = 0.45f;
-      activeEffect_ = EFFECT_ZZZ;
-      Serial.printf("[EYE] SLEEPING: Almost closed\n");
-    }
-    else if (strcmp(b->name, "confused") == 0) {
-      targetWidth_ = 28;
-      targetHeight_ = 38;
-      targetTopLid_ = 0.2f;
-      targetBottomLid_ = 0.0f;
-      activeEffect_ = EFFECT_QUESTION;
-      Serial.printf("[EYE] CONFUSED: Slightly tilted\n");
-    }
-    else if (strcmp(b->name, "thinking") == 0) {
-      targetWidth_ = 28;
-      targetHeight_ = 38;
-      targetTopLid_ = 0.0f;
-      targetBottomLid_ = 0.3f;
-      activeEffect_ = EFFECT_THINKING_DOTS;
-      Serial.printf("[EYE] THINKING: Concentrated\n");
-    }
-    else if (strcmp(b->name, "listening") == 0) {
-      targetWidth_ = 30;
-      targetHeight_ = 44;
-      targetTopLid_ = 0.0f;
-      targetBottomLid_ = 0.0f;
-      activeEffect_ = EFFECT_SCAN_BEAM;
-      Serial.printf("[EYE] LISTENING: Alert and scanning\n");
-    }
-    else if (strcmp(b->name, "playful_mischief") == 0) {
-      targetWidth_ = 28;
-      targetHeight_ = 36;
-      targetTopLid_ = 0.0f;
-      targetBottomLid_ = 0.3f;
-      activeEffect_ = EFFECT_SPARKLE;
-      Serial.printf("[EYE] PLAYFUL: Mischievous look\n");
-    }
-    else {
-      // calm_idle or unknown
-      targetWidth_ = 28;
-      targetHeight_ = 40;
-      targetTopLid_ = 0.0f;
-      targetBottomLid_ = 0.0f;
-      activeEffect_ = EFFECT_NONE;
-      Serial.printf("[EYE] CALM/DEFAULT: Neutral\n");
-    }
-    
-    targetOffsetX_ = b->offsetX;
-    targetOffsetY_ = b->offsetY;
-    
-    Serial.printf("[EYE] Target set: w=%.1f h=%.1f top=%.2f bot=%.2f offset=(%.1f,%.1f) effect=%d\n",
-                  targetWidth_, targetHeight_, targetTopLid_, targetBottomLid_,
-                  targetOffsetX_, targetOffsetY_, (int)activeEffect_);
+    setTarget(b->id);
   }
 
-  void update(float dt) {
-    // Smooth morphing
-    const float f = 0.15f;
-    currentWidth_ += (targetWidth_ - currentWidth_) * f;
-    currentHeight_ += (targetHeight_ - currentHeight_) * f;
-    currentOffsetX_ += (targetOffsetX_ - currentOffsetX_) * f;
-    currentOffsetY_ += (targetOffsetY_ - currentOffsetY_) * f;
-    
-    // CRITICAL: Smooth lid transitions
-    topLid_ += (targetTopLid_ - topLid_) * f;
-    bottomLid_ += (targetBottomLid_ - bottomLid_) * f;
+  // O(1): everything comes from the compile-time expression table
+  void setTarget(BehaviorId id) {
+    if (id >= BEH_COUNT) id = BEH_CALM_IDLE;
+    const EyeExpression* next = &EYE_EXPRESSIONS[id];
+    
+    // Outgoing expression eases out while the new one eases in;
+    // the transition lasts as long as the slower of the two.
+    uint16_t durMs = next->entryMs;
+    if (expr_ && expr_->exitMs > durMs) durMs = expr_->exitMs;
+    
+    // Morph from wherever the expression layer is (not the blended output,
+    // which has blink and gaze folded in); layer weights crossfade alongside
+    from_ = layers_[LAYER_EXPRESSION].value;
+    fromBlinkW_ = layers_[LAYER_BLINK].weight;
+    fromGazeW_ = layers_[LAYER_GAZE].weight;
+    to_.width = q16FromInt(next->width);
+    to_.height = q16FromInt(next->height);
+    to_.topLid = q16FromFloat(next->topLid);
+    to_.bottomLid = q16FromFloat(next->bottomLid);
+    to_.offsetX = q16FromInt(next->offsetX);
+    to_.offsetY = q16FromInt(next->offsetY);
+    toBlinkW_ = q16FromFloat(next->blink);
+    toGazeW_ = q16FromFloat(next->gaze);
+    expr_ = next;
+    
+    // Progress per second, so each tick is one multiply
+    transitionT_ = (durMs > 0) ? 0 : Q16_ONE;
+    transitionRate_ = (durMs > 0) ? (q16_t)(65536000UL / durMs) : Q16_ONE;
+    
+    // Swap the expression's effect overlay (restarts it if unchanged);
+    // particles already in flight finish their lifetime
+    stopEffect(activeEffect_);
+    activeEffect_ = next->effect;
+    startEffect(activeEffect_);
+    
+    // An expression's own clip replaces whatever plays; otherwise one-shot
+    // clips (boot) finish while the eyes tween underneath, loops stop
+    if (next->clip != CLIP_NONE) playClip(next->clip);
+    else if (clip_ && clip_->loop) stopClip();
+    
+    Serial.printf("[EYE] Target set: %s w=%d h=%d top=%.2f bot=%.2f offset=(%d,%d) effect=%d in %dms\n",
+                  BEHAVIORS[id].name, next->width, next->height, next->topLid, next->bottomLid,
+                  next->offsetX, next->offsetY, (int)activeEffect_, durMs);
+  }
 
-    // Smooth saccade
-    saccadeX_ += (targetSaccadeX_ - saccadeX_) * 0.2f;
-    saccadeY_ += (targetSaccadeY_ - saccadeY_) * 0.2f;
+  // Effect overlays run independently of each other; setTarget() manages the
+  // expression's own one, extra ones can be layered on top
+  void startEffect(EyeEffect effect) {
+    if (effect == EFFECT_NONE || effect > EFFECT_SCAN_BEAM) return;
+    const EyeEffectDef& fx = EYE_EFFECTS[effect];
+    particles_.start(effect, fx.emitters, fx.count, EFFECT_ANCHOR_X, EFFECT_ANCHOR_Y);
+  }
 
-    // Update effect timer
-    effectTimer_ += dt;
-    
-    // Blink only in neutral calm state
-    bool isNeutralCalm = (targetTopLid_ < 0.05f && 
-                          targetBottomLid_ < 0.05f && 
-                          activeEffect_ == EFFECT_NONE);
-    
-    if (isNeutralCalm) {
-      updateBlink(dt);
-    } else {
-      blinkFactor_ = 1.0f;
-      blinkTimer_ = 0.0f;
+  void stopEffect(EyeEffect effect) {
+    if (effect != EFFECT_NONE) particles_.stop(effect);
+  }
+
+  const ParticleStats& getParticleStats() const { return particles_.stats(); }
+  
+  // Pre-rendered clips (anim_clip.h), timed on the animation tick
+  void playClip(ClipId id) {
+    if (paged_ || id == CLIP_NONE || id >= CLIP_COUNT) {   // clips need the full buffer
+      stopClip();
+      return;
     }
-    
-    // Saccades only in neutral calm state
-    if (isNeutralCalm && targetHeight_ > 35) {
-      updateSaccades(dt);
+    clip_ = &ANIM_CLIPS[id];
+    clipTime_ = 0;
+    clipFrame_ = 0;
+    Serial.printf("[CLIP] Playing %s (%d frames @ %d fps)\n", clip_->name, clip_->frames, clip_->fps);
+  }
+  
+  void stopClip() { clip_ = nullptr; }
+  bool clipPlaying() const { return clip_ != nullptr; }
+  const ClipStats& getClipStats() const { return clipDecoder_.stats(); }
+  
+  // Drive the override layer (on top of everything): fields is an EyeField
+  // mask, weight 0..1 blends from the expression's eyes to p
+  void setOverride(const EyeParams& p, uint16_t fields, q16_t weight) {
+    EyeLayer& o = layers_[LAYER_OVERRIDE];
+    o.value = p;
+    o.fields = fields;
+    o.weight = weight;
+  }
+  
+  void clearOverride() { layers_[LAYER_OVERRIDE].weight = 0; }
+  
+  // Quality knobs for the frame governor
+  void setParticleLimit(uint8_t limit) { particles_.setLimit(limit); }
+  void setSaccadesEnabled(bool enabled) { saccadesEnabled_ = enabled; }
+  
+  // Voice energy 0..255 (low mic spectrum bands): the eyes lift up to
+  // EYE_VOICE_LIFT_PX towards the sound, through the gaze layer so each
+  // expression's gaze weight decides how much
+  void setVoiceLevel(uint8_t level) {
+    voiceLift_ = (q16FromInt(EYE_VOICE_LIFT_PX) * level) / 255;
+  }
+
+  void setTickInterval(float dt) {
+    tickDt_ = dt;
+    // Saccade smoothing was tuned as "fraction per frame" at ~60 FPS
+    saccadeK_ = q16FromFloat(smoothingForStep(0.2f, 60.0f, dt));
+  }
+
+  // Fixed-step integration, called once per AnimClock tick
+  void tick(float dt) {
+    prev_ = eye_;
+    const q16_t dtq = q16FromFloat(dt);
+    
+    // Timed, eased morph towards the expression (per-parameter curves)
+    if (transitionT_ < Q16_ONE) {
+      transitionT_ += q16Mul(dtq, transitionRate_);
+      if (transitionT_ > Q16_ONE) transitionT_ = Q16_ONE;
+    }
+    const q16_t ks = applyEase(expr_->easeShape, transitionT_);
+    const q16_t kl = applyEase(expr_->easeLids, transitionT_);
+    const q16_t kg = applyEase(expr_->easeGaze, transitionT_);
+    
+    EyeLayer& base = layers_[LAYER_EXPRESSION];
+    base.value.width = q16Lerp(from_.width, to_.width, ks);
+    base.value.height = q16Lerp(from_.height, to_.height, ks);
+    base.value.topLid = q16Lerp(from_.topLid, to_.topLid, kl);
+    base.value.bottomLid = q16Lerp(from_.bottomLid, to_.bottomLid, kl);
+    base.value.offsetX = q16Lerp(from_.offsetX, to_.offsetX, kg);
+    base.value.offsetY = q16Lerp(from_.offsetY, to_.offsetY, kg);
+    layers_[LAYER_BLINK].weight = q16Lerp(fromBlinkW_, toBlinkW_, kl);
+    layers_[LAYER_GAZE].weight = q16Lerp(fromGazeW_, toGazeW_, kg);
+
+    // Blink and saccades always run; their layer weights decide how much
+    // of them shows (nothing in a weight-0 expression)
+    updateBlink(dtq);
+    if (saccadesEnabled_) {
+      updateSaccades(dtq);
     } else {
       targetSaccadeX_ = 0;
       targetSaccadeY_ = 0;
     }
     
+    // Smooth saccade (snaps once sub-pixel, an exponential never arrives)
+    EyeParams& gaze = layers_[LAYER_GAZE].value;
+    gaze.saccadeX = follow(gaze.saccadeX, targetSaccadeX_);
+    gaze.saccadeY = follow(gaze.saccadeY, targetSaccadeY_ - voiceLift_);
+
+    layers_.evaluate(eye_);
+
+    // Effect particles
+    particles_.tick(dtq);
+    
+    if (clip_) tickClip(dtq);
+    if (subtitleLen_) subtitleTime_ += dtq;
+    
     // Debug output every 5 seconds (reduced during sleep to prevent overhead)
     static unsigned long lastDebug = 0;
     unsigned long debugInterval = (activeEffect_ == EFFECT_ZZZ) ? 5000 : 1000; // Less frequent during sleep
     if (millis() - lastDebug > debugInterval) {
-      Serial.printf("[EYE] Current: w=%.1f h=%.1f topLid=%.2f/%.2f botLid=%.2f/%.2f blink=%.2f effect=%d\n",
-                    currentWidth_, currentHeight_, 
-                    topLid_, targetTopLid_,
-                    bottomLid_, targetBottomLid_,
-                    blinkFactor_, (int)activeEffect_);
+      Serial.printf("[EYE] Current: w=%.1f h=%.1f topLid=%.2f/%.2f botLid=%.2f/%.2f blink=%.2f effect=%d particles=%d\n",
+                    q16ToFloat(eye_.width), q16ToFloat(eye_.height), 
+                    q16ToFloat(eye_.topLid), expr_->topLid,
+                    q16ToFloat(eye_.bottomLid), expr_->bottomLid,
+                    q16ToFloat(eye_.blink), (int)activeEffect_, particles_.stats().live);
       lastDebug = millis();
     }
   }
 
 private:
   U8G2& display_;
+  bool paged_ = false;              // page-buffer display, see renderPaged()
+  uint8_t pagesOnPanel_ = 0xFF;     // paged: pages that may hold lit pixels
+  uint32_t pageHash_[8] = {};       // paged: hash of each page as last sent
+  FlushStats pageStats_;            // paged: same counters, whole pages
+#if !OLED_PAGE_BUFFER
+  TileFlusher flusher_;
+  EyeShapeCache shapeCache_;
+  bool useShapeCache_ = true;
+#endif
   
-  float currentWidth_ = 28;
-  float currentHeight_ = 40;
-  float targetWidth_ = 28;
-  float targetHeight_ = 40;
-  
-  float currentOffsetX_ = 0;
-  float currentOffsetY_ = 0;
-  float targetOffsetX_ = 0;
-  float targetOffsetY_ = 0;
-  
-  float topLid_ = 0.0f;
-  float bottomLid_ = 0.0f;
-  float targetTopLid_ = 0.0f;
-  float targetBottomLid_ = 0.0f;
-  
-  float blinkFactor_ = 1.0f;
-  float blinkTimer_ = 0.0f;
-  float nextBlink_ = 4.0f;
-  
-  float saccadeX_ = 0;
-  float saccadeY_ = 0;
-  float saccadeTimer_ = 0;
-  float targetSaccadeX_ = 0; 
-  float targetSaccadeY_ = 0;
-  
-  enum EffectType {
-    EFFECT_NONE,
-    EFFECT_HEART,
-    EFFECT_STARS,
-    EFFECT_SPARKLE,
-    EFFECT_ZZZ,
-    EFFECT_QUESTION,
-    EFFECT_THINKING_DOTS,
-    EFFECT_SCAN_BEAM
-  } activeEffect_ = EFFECT_NONE;
-  
-  float effectTimer_ = 0;
+  EyeLayerStack layers_;  // expression / gaze / blink / override, see eye_layers.h
+  EyeParams eye_;   // blended state after the latest tick
+  EyeParams prev_;  // state one tick earlier, for render interpolation
+  float tickDt_ = 1.0f / 60.0f;
+  q16_t saccadeK_ = q16(0.2f);
+  static const q16_t SNAP_EPSILON = Q16_ONE / 32;   // px, well under a pixel
+  
+  // Expression transition
+  const EyeExpression* expr_ = &EYE_EXPRESSIONS[BEH_CALM_IDLE];
+  EyeParams from_;                  // state when the transition started
+  EyeParams to_;                    // expression target (lids, shape, gaze)
+  q16_t fromBlinkW_ = Q16_ONE;      // layer weights when the transition started
+  q16_t fromGazeW_ = Q16_ONE;
+  q16_t toBlinkW_ = Q16_ONE;        // ... and the expression's own
+  q16_t toGazeW_ = Q16_ONE;
+  q16_t transitionT_ = Q16_ONE;     // linear progress 0..1
+  q16_t transitionRate_ = Q16_ONE;  // progress per second
+  
+  q16_t blinkTimer_ = 0;         // seconds
+  q16_t nextBlink_ = q16(4.0f);
+  
+  q16_t saccadeTimer_ = 0;
+  q16_t targetSaccadeX_ = 0;     // px
+  q16_t targetSaccadeY_ = 0;
+  q16_t voiceLift_ = 0;
+  bool saccadesEnabled_ = true;
+  
+  EyeEffect activeEffect_ = EFFECT_NONE;
+  ParticleSystem particles_;
+  
+  const AnimClip* clip_ = nullptr;  // tick side
+  q16_t clipTime_ = 0;              // seconds since the clip started
+  uint16_t clipFrame_ = 0;
+  ClipDecoder clipDecoder_;         // render side, knows what the buffer holds
+  
+  char subtitleText_[SUBTITLE_MAX_CHARS + 1] = {};   // tick side
+  uint8_t subtitleLen_ = 0;         // 0 = hidden
+  uint16_t subtitleId_ = 0;         // bumped per text, never 0 once shown
+  q16_t subtitleTime_ = 0;          // seconds shown
+  int16_t subtitlePermille_ = -1;   // playback progress, -1 = pace by time
+  SubtitleStrip subtitleStrip_;     // render side
+  
+  void tickClip(q16_t dt) {
+    clipTime_ += dt;
+    uint32_t frame = ((uint32_t)clipTime_ * clip_->fps) >> 16;
+    if (frame < clip_->frames) {
+      clipFrame_ = frame;
+      return;
+    }
+    if (clip_->loop) {
+      clipFrame_ = frame % clip_->frames;
+      return;
+    }
+    Serial.printf("[CLIP] %s done\n", clip_->name);
+    clip_ = nullptr;
+  }
+  
+  // Strip column at the left screen edge. Text that fits is centred and
+  // still; longer text keeps the spoken position in the middle of the
+  // screen, so it starts at the centre and ends with its tail there.
+  int16_t subtitleScroll() const {
+    const int32_t w = SubtitleStrip::widthOf(subtitleLen_);
+    if (w <= 128) return -(int16_t)((128 - w) / 2);
+    uint32_t permille;
+    if (subtitlePermille_ >= 0) {
+      permille = subtitlePermille_;
+    } else {
+      uint32_t ms = ((uint64_t)subtitleTime_ * 1000) >> 16;
+      permille = min<uint32_t>(1000, ms * 1000 / ((uint32_t)subtitleLen_ * SUBTITLE_MS_PER_CHAR));
+    }
+    return (int16_t)(w * permille / 1000) - 64;
+  }
 
-  void updateBlink(float dt) {
+  // Exponential follower step that lands exactly on the target once within
+  // SNAP_EPSILON, so converged state stops changing (see frameChanged())
+  q16_t follow(q16_t v, q16_t target) const {
+    q16_t d = target - v;
+    if (d > -SNAP_EPSILON && d < SNAP_EPSILON) return target;
+    return v + q16Mul(d, saccadeK_);
+  }
+  
+  void updateBlink(q16_t dt) {
+    q16_t& blink = layers_[LAYER_BLINK].value.blink;
     blinkTimer_ += dt;
     
     if (blinkTimer_ > nextBlink_) {
-      float seq = blinkTimer_ - nextBlink_;
+      q16_t seq = blinkTimer_ - nextBlink_;
       
-      if (seq < 0.15f) {
-        float t = seq / 0.15f;
-        t = t * t * (3.0f - 2.0f * t);
-        blinkFactor_ = 1.0f - t;
+      if (seq < q16(0.15f)) {
+        blink = Q16_ONE - q16Smoothstep(q16Mul(seq, q16(1.0f / 0.15f)));
       }
-      else if (seq < 0.20f) {
-        blinkFactor_ = 0.0f;
+      else if (seq < q16(0.20f)) {
+        blink = 0;
       }
-      else if (seq < 0.40f) {
-        float t = (seq - 0.20f) / 0.20f;
-        t = t * t * (3.0f - 2.0f * t);
-        blinkFactor_ = t;
+      else if (seq < q16(0.40f)) {
+        blink = q16Smoothstep(q16Mul(seq - q16(0.20f), q16(1.0f / 0.20f)));
       }
       else {
         blinkTimer_ = 0;
-        nextBlink_ = 3.5f + (random(30) / 10.0f);
-        if (random(100) < 6) nextBlink_ = 0.5f;
-        blinkFactor_ = 1.0f;
+        nextBlink_ = q16(3.5f) + random(30) * (Q16_ONE / 10);
+        if (random(100) < 6) nextBlink_ = Q16_HALF;
+        blink = Q16_ONE;
       }
     }
   }
 
-  void updateSaccades(float dt) {
+  void updateSaccades(q16_t dt) {
     saccadeTimer_ += dt;
     
-    if (saccadeTimer_ > 2.5f) {
+    if (saccadeTimer_ > q16(2.5f)) {
       if (random(100) < 30) {
         saccadeTimer_ = 0;
-        targetSaccadeX_ = random(31) - 15; 
-        targetSaccadeY_ = random(9) - 4;   
+        targetSaccadeX_ = q16FromInt(random(31) - 15); 
+        targetSaccadeY_ = q16FromInt(random(9) - 4);   
       } 
       else if (random(100) < 10) {
         targetSaccadeX_ = 0;
@@ -291,202 +407,113 @@ private:
     }
   }
   
-  void drawEye(int cx, int cy, bool drawEffects) {
+  static const int LEFT_EYE_CX = 32;
+  static const int RIGHT_EYE_CX = 96;
+  static const int EYE_CY = 32;
+  
+  // Pixel geometry of one eye, everything drawEye() puts on screen
+  struct EyeGeometry {
+    int16_t x, y, w, h, r, topH, botH;
+  };
+  
+  static EyeGeometry eyeGeometry(int cx, int cy, const EyeParams& p) {
+    EyeGeometry g;
+    
     // Calculate eye dimensions (blink affects height only)
-    int w = constrain((int)currentWidth_, 20, 40);
-    int h = constrain((int)(currentHeight_ * blinkFactor_), 4, 52);
+    int w = constrain(q16ToInt(p.width), 20, 40);
+    int h = constrain(q16ToInt(q16Mul(p.height, p.blink)), 4, 52);
     
     // Calculate position
-    int totalOffsetX = constrain((int)(currentOffsetX_ + saccadeX_), -10, 10);
-    int totalOffsetY = constrain((int)(currentOffsetY_ + saccadeY_), -8, 8);
-    
-    int x = cx + totalOffsetX - (w / 2);
-    int y = cy + totalOffsetY - (h / 2);
+    int totalOffsetX = constrain(q16ToInt(p.offsetX + p.saccadeX), -10, 10);
+    int totalOffsetY = constrain(q16ToInt(p.offsetY + p.saccadeY), -8, 8);
     
     // Keep on screen
-    x = constrain(x, 0, 128 - w);
-    y = constrain(y, 0, 64 - h);
+    g.x = constrain(cx + totalOffsetX - (w / 2), 0, 128 - w);
+    g.y = constrain(cy + totalOffsetY - (h / 2), 0, 64 - h);
+    g.w = w;
+    g.h = h;
     
     // Dynamic radius to prevent glitches when eye is very small
-    int r = (h < 16) ? (h / 2) : 8;
-    
-    // STEP 1: Draw white eye base
-    display_.setDrawColor(1);
-    display_.drawRBox(x, y, w, h, r);
+    g.r = (h < 16) ? (h / 2) : 8;
     
-    // STEP 2: Draw BLACK eyelid overlays
-    display_.setDrawColor(0);
-    
-    // Top lid (covers from top downward)
-    int topH = (int)(h * topLid_);
-    if (topH > 0) {
-      display_.drawBox(x, y, w, topH);
-    }
-    
-    // Bottom lid (covers from bottom upward)
-    int botH = (int)(h * bottomLid_);
-    if (botH > 0) {
-      display_.drawBox(x, y + h - botH, w, botH);
+    // Lid fractions are rounded to Q16, so nudge by ~0.001px to keep exact
+    // products (40 * 0.4) on the same pixel as the float version
+    g.topH = (h * p.topLid + 64) >> 16;
+    g.botH = (h * p.bottomLid + 64) >> 16;
+    return g;
+  }
+  
+  static uint32_t hashStep(uint32_t h, uint8_t b) {
+    return (h ^ b) * 16777619UL;
+  }
+  
+  void drawEye(int cx, int cy, const EyeFrame& f, bool logDebug) {
+    const EyeParams& p = f.view;
+    const EyeGeometry g = eyeGeometry(cx, cy, p);
+    const int x = g.x, y = g.y, w = g.w, h = g.h, r = g.r;
+    const int topH = g.topH, botH = g.botH;
+    
+#if !OLED_PAGE_BUFFER
+    if (useShapeCache_ && !paged_) {
+      // Cached mask already has the lids carved out; blit straight into the buffer
+      shapeCache_.blit(display_.getBufferPtr(), x, y, w, h, r, topH, botH);
+    } else
+#endif
+    {
+      // STEP 1: Draw white eye base
+      display_.setDrawColor(1);
+      display_.drawRBox(x, y, w, h, r);
+      
+      // STEP 2: Draw BLACK eyelid overlays
+      display_.setDrawColor(0);
+      
+      // Top lid (covers from top downward)
+      if (topH > 0) {
+        display_.drawBox(x, y, w, topH);
+      }
+      
+      // Bottom lid (covers from bottom upward)
+      if (botH > 0) {
+        display_.drawBox(x, y + h - botH, w, botH);
+      }
     }
     
     // Debug: Print lid calculations
     static unsigned long lastLidDebug = 0;
-    if (millis() - lastLidDebug > 2000 && drawEffects) {
+    if (millis() - lastLidDebug > 2000 && logDebug) {
       Serial.printf("[EYE RENDER] Eye at (%d,%d) size %dx%d, topLid=%dpx (%.2f), botLid=%dpx (%.2f)\n",
-                    x, y, w, h, topH, topLid_, botH, bottomLid_);
+                    x, y, w, h, topH, q16ToFloat(p.topLid), botH, q16ToFloat(p.bottomLid));
       lastLidDebug = millis();
     }
-    
-    // STEP 3: Draw effects on right eye only
-    if (drawEffects && activeEffect_ != EFFECT_NONE) {
-      renderEffect(cx, cy);
-    }
   }
 
     // FIXED: Reduced ZZZ effect size
   const float ZZZ_EFFECT_SCALE = 0.5f; // Reduced from 0.8 to 0.5
   const float EFFECT_STARS_SCALE = 0.5f; // Reduced from 1.0 to 0.7
 
-  void renderEffect(int cx, int cy) {
-    display_.setDrawColor(1);
-    display_.setFont(u8g2_font_6x10_tr); // Small font for ZZZ
-
-    switch (activeEffect_) {
-      case EFFECT_ZZZ: {
-        // SLEEP FIX: Pre-calculate to avoid fmod() overhead causing micro-freezes
-        // Use integer math where possible
-        int cycleMs = ((int)(effectTimer_ * 1000)) % 3000; // 3 second cycle
-        
-        // Z1 - cycles 0-3000ms
-        int y1 = 20 - (cycleMs * 8 / 1000);
-        if (y1 > -5 && y1 < 64) display_.drawStr(cx + 8, y1, "z");
-
-        // Z2 - offset by 1000ms
-        int t2 = (cycleMs + 1000) % 3000;
-        int y2 = 20 - (t2 * 8 / 1000);
-        if (y2 > -5 && y2 < 64) display_.drawStr(cx + 16, y2, "Z");
-
-        // Z3 - offset by 2000ms
-        int t3 = (cycleMs + 2000) % 3000;
-        int y3 = 20 - (t3 * 8 / 1000);
-        if (y3 > -5 && y3 < 64) display_.drawStr(cx + 24, y3, "z");
-        break;
-      }
-      
-      case EFFECT_HEART: {
-        // BIG hearts floating up
-        if ((int)(effectTimer_ * 2) % 3 == 0) {
-          int heartY = 20 - (int)(effectTimer_ * 15) % 30;
-          if (heartY > 10 && heartY < 55) {
-            int hx = cx + 22;
-            display_.drawBox(hx, heartY, 2, 2);
-            display_.drawBox(hx + 4, heartY, 2, 2);
-            display_.drawBox(hx - 1, heartY + 2, 8, 3);
-            display_.drawBox(hx + 1, heartY + 5, 4, 2);
-            display_.drawBox(hx + 2, heartY + 7, 2, 2);
-          }
-        }
-        break;
-      }
-      
-      case EFFECT_STARS: {
-        // Switch to bigger font for stars
-        display_.setFont(u8g2_font_9x15_tr);
-        
-        if (effectTimer_ < 1.0f) {
-          int spread = (int)(effectTimer_ * 15);
-          
-          int sx = cx + 12 + spread;
-          int sy = cy - 10 - spread/2;
-          if (sx >= 0 && sx < 125 && sy >= 0 && sy < 60) {
-            display_.drawStr(sx, sy, "*");
-          }
-          
-          sx = cx + 12 + spread;
-          sy = cy + 10 + spread/2;
-          if (sx >= 0 && sx < 125 && sy >= 0 && sy < 60) {
-            display_.drawStr(sx, sy, "*");
-          }
-          
-          display_.drawStr(cx + 18, cy, "*");
-        }
-        break;
-      }
-      
-      case EFFECT_SPARKLE: {
-        
-        // Sparkle 1 (Top Right) - Position: X+22, Y-12
-        float t1 = fmod(effectTimer_ * 3.0f, 1.0f); // 3Hz Speed
-        if (t1 < 0.6f) { 
-           // Curve goes 0 -> 1 -> 0
-           float intensity = sin(t1 * 3.14159f / 0.6f); 
-           int r = (int)(intensity * 4.0f); // Max Radius = 4
-           if (r > 0) {
-             int sx = cx + 22; int sy = cy - 12; 
-             display_.drawLine(sx - r, sy, sx + r, sy); // Horizontal Line
-             display_.drawLine(sx, sy - r, sx, sy + r); // Vertical Line
-           }
-        }
-
-        // Sparkle 2 (Far Right) - Position: X+30, Y-2
-        float t2 = fmod(effectTimer_ * 2.0f + 0.3f, 1.0f); // Offset timing
-        if (t2 < 0.6f) {
-           float intensity = sin(t2 * 3.14159f / 0.6f);
-           int r = (int)(intensity * 5.0f); // Max Radius = 5 (Big one)
-           if (r > 0) {
-             int sx = cx + 30; int sy = cy - 2;
-             display_.drawLine(sx - r, sy, sx + r, sy);
-             display_.drawLine(sx, sy - r, sx, sy + r);
-           }
-        }
-
-        // Sparkle 3 (Bottom Right) - Position: X+24, Y+10
-        float t3 = fmod(effectTimer_ * 2.5f + 0.7f, 1.0f);
-        if (t3 < 0.6f) {
-           float intensity = sin(t3 * 3.14159f / 0.6f);
-           int r = (int)(intensity * 3.0f); // Max Radius = 3 (Small one)
-           if (r > 0) {
-             int sx = cx + 24; int sy = cy + 10;
-             display_.drawLine(sx - r, sy, sx + r, sy);
-             display_.drawLine(sx, sy - r, sx, sy + r);
-           }
-        }
-        break;
-      }
-
-      case EFFECT_QUESTION: {
-        display_.setFont(u8g2_font_9x15_tr);
-        int qY = 25 - (int)(effectTimer_ * 15) % 35;
-        if (qY > 8 && qY < 58) {
-          display_.drawStr(cx + 20, qY, "?");
-        }
-        break;
-      }
-
-      case EFFECT_THINKING_DOTS: {
-
-      }
-      
-      case EFFECT_SCAN_BEAM: {
-        
-      }
-      
-      // Default / Other effects
-      default: break;
-    }
-  }
-  
   // NEW: Stopwatch display mode
   bool stopwatchMode_ = false;
   int stopwatchMin_ = 0;
   int stopwatchSec_ = 0;
   int stopwatchCentis_ = 0;
+  uint32_t lastFrameKey_ = 0;       // main loop side, see frameChanged()
+  bool frameKeyValid_ = false;
+  uint32_t elidedFrames_ = 0;
+#if !OLED_PAGE_BUFFER
+  StopwatchView stopwatchView_;     // render side
+#endif
+  bool stopwatchShown_ = false;     // panel currently shows the stopwatch
+  OledBus* bus_ = nullptr;          // async transport, nullptr = blocking U8g2 callback
+  OledMirror* mirror_ = nullptr;    // dashboard stream, render side
   
 public:
   // NEW PUBLIC METHODS FOR STOPWATCH
   
   // Stopwatch display mode (no eyes, just large digits)
   void showStopwatch(int minutes, int seconds, int centis) {
+    // Keep only the precision that is actually displayed
+    if (STOPWATCH_PRECISION < 2) centis -= centis % 10;
+    if (STOPWATCH_PRECISION < 1) centis = 0;
     stopwatchMode_ = true;
     stopwatchMin_ = minutes;
     stopwatchSec_ = seconds;
@@ -497,48 +524,334 @@ public:
     stopwatchMode_ = false;
   }
   
-  void render() {
+  // Marquee along the bottom row while text is spoken. Paced by
+  // setSubtitleProgress() when the audio length is known, otherwise by
+  // SUBTITLE_MS_PER_CHAR.
+  void showSubtitle(const char* text) {
+    strncpy(subtitleText_, text, SUBTITLE_MAX_CHARS);
+    subtitleText_[SUBTITLE_MAX_CHARS] = '\0';
+    subtitleLen_ = strlen(subtitleText_);
+    if (++subtitleId_ == 0) subtitleId_ = 1;
+    subtitleTime_ = 0;
+    subtitlePermille_ = -1;
+  }
+  
+  void setSubtitleProgress(int16_t permille) {
+    subtitlePermille_ = permille < 0 ? -1 : min<int16_t>(permille, 1000);
+  }
+  
+  void hideSubtitle() { subtitleLen_ = 0; }
+  bool subtitleShowing() const { return subtitleLen_ > 0; }
+  
+  // False if the frame would put exactly the same pixels on the panel as the
+  // last one handed out (same frameKey()), so settled eyes and an unchanged
+  // stopwatch cost no rasterize, no flush and no I2C at all.
+  bool frameChanged(const EyeFrame& f) {
+    uint32_t key = frameKey(f);
+    if (frameKeyValid_ && key == lastFrameKey_) {
+      elidedFrames_++;
+      return false;
+    }
+    lastFrameKey_ = key;
+    frameKeyValid_ = true;
+    return true;
+  }
+  
+  // Make the next frame go out even if it looks unchanged
+  void forceFrame() { frameKeyValid_ = false; }
+  
+  uint32_t getElidedFrames() const { return elidedFrames_; }
+  
+  // FNV-1a over the quantized render state: the integer geometry drawEye()
+  // will use, every particle sprite (position, kind, life-shaped size) and
+  // the stopwatch digits, the subtitle text and scroll column. Equal keys
+  // mean identical frame buffers.
+  uint32_t frameKey(const EyeFrame& f) const {
+    uint32_t h = 2166136261UL;
+    h = hashStep(h, f.stopwatch);
+    if (f.stopwatch) {
+      h = hashStep(h, f.swMin);
+      h = hashStep(h, f.swSec);
+      return hashStep(h, f.swCentis);
+    }
+    h = hashStep(h, f.clip);
+    if (f.clip != CLIP_NONE) {
+      h = hashStep(h, (uint8_t)f.clipFrame);
+      return hashStep(h, (uint8_t)(f.clipFrame >> 8));
+    }
+    if (f.subtitleId) {
+      h = hashStep(h, (uint8_t)f.subtitleId);
+      h = hashStep(h, (uint8_t)(f.subtitleId >> 8));
+      h = hashStep(h, (uint8_t)f.subtitleX);
+      h = hashStep(h, (uint8_t)(f.subtitleX >> 8));
+    }
+    
+    const EyeGeometry g[2] = { eyeGeometry(LEFT_EYE_CX, EYE_CY, f.view),
+                               eyeGeometry(RIGHT_EYE_CX, EYE_CY, f.view) };
+    const uint8_t* gb = (const uint8_t*)g;
+    for (size_t i = 0; i < sizeof(g); i++) h = hashStep(h, gb[i]);
+    
+    h = hashStep(h, f.particles.count);
+    for (uint8_t i = 0; i < f.particles.count; i++) {
+      const ParticleSprite& sp = f.particles.sprites[i];
+      h = hashStep(h, (uint8_t)sp.x);
+      h = hashStep(h, (uint8_t)(sp.x >> 8));
+      h = hashStep(h, (uint8_t)sp.y);
+      h = hashStep(h, (uint8_t)(sp.y >> 8));
+      h = hashStep(h, sp.kind);
+      h = hashStep(h, sp.size);
+      h = hashStep(h, (uint8_t)sp.glyph);
+    }
+    return h;
+  }
+  
+  // Capture everything needed to draw the current state.
+  // alpha: fraction of a tick since the last tick (AnimClock::alpha())
+  EyeFrame snapshot(float alpha = 1.0f) const {
+    EyeFrame f;
+    // Draw between the last two ticks so motion is independent of render FPS
+    f.view = EyeParams::lerp(prev_, eye_, q16FromFloat(alpha));
+    particles_.snapshot(f.particles);
+    f.stopwatch = stopwatchMode_;
+    f.swMin = stopwatchMin_;
+    f.swSec = stopwatchSec_;
+    f.swCentis = stopwatchCentis_;
+    if (clip_) {
+      f.clip = clip_->id;
+      f.clipFrame = clipFrame_;
+    }
+    if (subtitleLen_) {
+      f.subtitleId = subtitleId_;
+      f.subtitleX = subtitleScroll();
+      memcpy(f.subtitle, subtitleText_, subtitleLen_ + 1);
+    }
+    return f;
+  }
+  
+  // Rasterize a snapshot and push it to the panel. Only touches the display
+  // and flush state, so it may run on the render task while the main loop
+  // keeps ticking the engine.
+  // Returns false if the frame was skipped because the async bus is still
+  // busy; nothing was drawn, so its changes go out with the next frame.
+  bool renderFrame(const EyeFrame& f) {
+    if (bus_) {
+      if (bus_->takeResync()) invalidatePanel();
+      if (!bus_->ready()) {
+        bus_->noteRefused();
+        return false;
+      }
+    }
+    
+    if (paged_) {
+      renderPaged(f);
+    } else {
+#if OLED_PAGE_BUFFER
+      rasterize(f);
+      display_.sendBuffer();
+#else
+      if (f.stopwatch && stopwatchShown_) {
+        // Stopwatch already on the panel: rewrite and push only changed digits
+        uint16_t cols = stopwatchView_.update(display_, f.swMin, f.swSec, f.swCentis);
+        if (cols) flusher_.flushTiles(cols, stopwatchView_.firstTileRow(), stopwatchView_.lastTileRow());
+      } else {
+        rasterize(f);
+        
+        // Push only the tiles that changed since the last frame
+        flusher_.flush();
+        stopwatchShown_ = f.stopwatch;
+      }
+#endif
+      if (mirror_) mirror_->capture(display_.getBufferPtr());
+    }
+    
+    if (bus_) bus_->commit();
+    return true;
+  }
+  
+  // Draw a snapshot into the U8g2 buffer without sending it (full buffer;
+  // on a page buffer this only draws the current page)
+  void rasterize(const EyeFrame& f) {
+    if (f.clip != CLIP_NONE && !f.stopwatch && !paged_) {
+      // Clip frames decode over the previous clip frame, no clear
+      clipDecoder_.decode(display_.getBufferPtr(), ANIM_CLIPS[f.clip], f.clipFrame);
+      return;
+    }
+    
     display_.clearBuffer();
+    clipDecoder_.invalidate();
     
     // Special mode: Stopwatch display (no eyes)
-    if (stopwatchMode_) {
-      renderStopwatch();
+    if (f.stopwatch) {
+      renderStopwatch(f);
     } else {
-      renderEyes();
+      renderEyes(f);
     }
-    
-    display_.sendBuffer();
   }
   
+  // Inline render on the calling task (fallback when no render task runs)
+  void render(float alpha = 1.0f) {
+    EyeFrame f = snapshot(alpha);
+    if (!frameChanged(f)) return;
+    if (!renderFrame(f)) forceFrame();   // bus busy, try again next frame
+  }
+  
+  // Flush counters (bytes sent, tiles skipped...) for telemetry
+  const FlushStats& getFlushStats() const {
+#if !OLED_PAGE_BUFFER
+    if (!paged_) return flusher_.stats();
+#endif
+    return pageStats_;
+  }
+  
+#if !OLED_PAGE_BUFFER
+  // Pre-rasterized eye masks (default) vs. per-frame drawRBox/drawBox
+  void setShapeCache(bool enabled) { useShapeCache_ = enabled; }
+  const EyeShapeCacheStats& getShapeCacheStats() const { return shapeCache_.stats(); }
+#endif
+  
+  bool pageBuffered() const { return paged_; }
+  
+  // Call after anything that changes panel RAM behind our back (re-init, power save)
+  void invalidateDisplay() {
+    invalidatePanel();
+    forceFrame();
+  }
+  
+  // Queue flushes on an async OLED transport instead of waiting for the I2C
+  // transfer (the display must be set up on OledBus::byteCb)
+  void attachBus(OledBus* bus) { bus_ = bus; }
+  OledBus* bus() const { return bus_; }
+  
+  // Stream every frame sent to the panel to the dashboard (full buffer only)
+  void attachMirror(OledMirror* mirror) { mirror_ = paged_ ? nullptr : mirror; }
+  OledMirror* mirror() const { return mirror_; }
+  
 private:
-  void renderStopwatch() {
-    // Ensure normal display mode (white text on black background)
-    display_.setDisplayRotation(U8G2_R0);
+  // Render-side notion of what the panel shows is unknown: resend everything
+  void invalidatePanel() {
+#if !OLED_PAGE_BUFFER
+    flusher_.invalidate();
+#endif
+    pagesOnPanel_ = 0xFF;
+  }
+  
+  void renderStopwatch(const EyeFrame& f) {
+#if !OLED_PAGE_BUFFER
+    if (!paged_) {
+      // Glyphs come from the view's cache, no per-frame font rasterization
+      stopwatchView_.drawFull(display_, f.swMin, f.swSec, f.swCentis);
+      return;
+    }
+#endif
+    // Plain font drawing, same layout as StopwatchView
     display_.setFontMode(1);
     display_.setDrawColor(1);
-    
-    display_.setFont(u8g2_font_logisoso28_tn); // Large numeric font
-    
-    char timeStr[12];
-    snprintf(timeStr, sizeof(timeStr), "%02d:%02d", stopwatchMin_, stopwatchSec_);
-    
-    // Center the time display
-    int strWidth = display_.getStrWidth(timeStr);
-    int x = (128 - strWidth) / 2;
-    display_.drawStr(x, 42, timeStr);
-    
-    // Smaller centiseconds below
     display_.setFont(u8g2_font_6x10_tr);
-    snprintf(timeStr, sizeof(timeStr), ".%02d", stopwatchCentis_);
-    display_.drawStr(x + strWidth + 2, 42, timeStr);
-    
-    // Label at top
     display_.drawStr(40, 12, "STOPWATCH");
+    
+    char str[10];                   // fits two int8_t: "-128:-128"
+    display_.setFont(u8g2_font_logisoso28_tn);
+    snprintf(str, sizeof(str), "%02d:%02d", f.swMin, f.swSec);
+    int w = display_.getStrWidth(str);
+    int x = (128 - w) / 2;
+    display_.drawStr(x, 42, str);
+    
+    if (STOPWATCH_PRECISION > 0) {
+      display_.setFont(u8g2_font_6x10_tr);
+      snprintf(str, sizeof(str), ".%02d", f.swCentis);
+      str[1 + STOPWATCH_PRECISION] = '\0';
+      display_.drawStr(x + w + 2, 42, str);
+    }
+  }
+  
+  // Pages (bit = 8-pixel row band) the frame draws anything on
+  uint8_t contentPages(const EyeFrame& f) const {
+    if (f.stopwatch) return 0x3F;                  // label, digits: rows 0..47
+    
+    uint8_t pages = f.subtitleId ? (1 << SubtitleStrip::PAGE) : 0;
+    const int cx[2] = { LEFT_EYE_CX, RIGHT_EYE_CX };
+    for (uint8_t e = 0; e < 2; e++) {
+      EyeGeometry g = eyeGeometry(cx[e], EYE_CY, f.view);
+      pages |= pageSpan(g.y + g.topH, g.y + g.h - 1 - g.botH);
+    }
+    for (uint8_t i = 0; i < f.particles.count; i++) {
+      const ParticleSprite& s = f.particles.sprites[i];
+      switch (s.kind) {
+        case PK_GLYPH:     pages |= pageSpan(s.y - 10, s.y + 2); break;
+        case PK_GLYPH_BIG: pages |= pageSpan(s.y - 15, s.y + 4); break;
+        case PK_HEART:     pages |= pageSpan(s.y, s.y + 9); break;
+        default:           pages |= pageSpan(s.y - s.size, s.y + s.size); break;
+      }
+    }
+    return pages;
+  }
+  
+  static uint8_t pageSpan(int y0, int y1) {
+    if (y1 < y0 || y1 < 0 || y0 > 63) return 0;
+    int p0 = y0 < 0 ? 0 : y0 >> 3;
+    int p1 = y1 > 63 ? 7 : y1 >> 3;
+    return (uint8_t)((0xFF >> (7 - p1)) & (0xFF << p0));
+  }
+  
+  // Page-buffer frame: draw only pages with content now or last frame, send
+  // the ones that came out different from what the panel has
+  void renderPaged(const EyeFrame& f) {
+    const uint8_t step = display_.getBufferTileHeight();
+    const uint8_t used = contentPages(f);
+    const uint8_t send = used | pagesOnPanel_;
+    pageStats_.frames++;
+    if (pagesOnPanel_ == 0xFF) pageStats_.fullFrames++;
+    
+    // The strip is rasterized through the page buffer, so before the loop
+    if (f.subtitleId && !f.stopwatch) subtitleStrip_.build(display_, f.subtitleId, f.subtitle);
+    
+    for (uint8_t row = 0; row < 8; row += step) {
+      const uint8_t bits = (uint8_t)(((1u << step) - 1) << row);
+      if (!(send & bits)) {
+        pageStats_.tilesSkipped += 16 * step;
+        continue;
+      }
+      display_.setBufferCurrTileRow(row);
+      display_.clearBuffer();
+      if (used & bits) {
+        if (f.stopwatch) renderStopwatch(f);
+        else renderEyes(f);
+      }
+      
+      // A 32-byte hash table stands in for the 1 KB tile shadow: identical
+      // pages (eye interior while only a particle moves elsewhere) stay put
+      uint32_t h = 2166136261UL;
+      const uint8_t* buf = display_.getBufferPtr();
+      for (uint16_t i = 0; i < 128u * step; i++) h = hashStep(h, buf[i]);
+      if (pagesOnPanel_ != 0xFF && h == pageHash_[row]) {
+        pageStats_.tilesSkipped += 16 * step;
+        continue;
+      }
+      pageHash_[row] = h;
+      
+      display_.sendBuffer();
+      pageStats_.tilesSent += 16 * step;
+      pageStats_.bytesSent += 128 * step;
+      pageStats_.areaCalls++;
+    }
+    pagesOnPanel_ = used;
+  }
+
+  
+  void renderEyes(const EyeFrame& f) {
+    if (f.subtitleId) subtitleStrip_.build(display_, f.subtitleId, f.subtitle);
+    drawEye(LEFT_EYE_CX, EYE_CY, f, false);  // Left eye
+    drawEye(RIGHT_EYE_CX, EYE_CY, f, true);  // Right eye
+    drawParticles(display_, f.particles);
+    drawSubtitle(f);
   }
   
-  void renderEyes() {
-    drawEye(32, 32, false);  // Left eye
-    drawEye(96, 32, true);   // Right eye with effects
+  // Subtitle band replaces whatever the eyes / particles put on its page
+  void drawSubtitle(const EyeFrame& f) {
+    if (!f.subtitleId) return;
+    const uint8_t row = display_.getBufferCurrTileRow();
+    if (SubtitleStrip::PAGE < row || SubtitleStrip::PAGE >= row + display_.getBufferTileHeight()) return;
+    subtitleStrip_.blit(display_.getBufferPtr() + (SubtitleStrip::PAGE - row) * 128, f.subtitleX);
   }
 };
 
@@ -0,0 +1,174 @@
+#ifndef EYE_EXPRESSIONS_H
+#define EYE_EXPRESSIONS_H
+
+#include <Arduino.h>
+#include "behaviors.h"
+#include "fixed_math.h"
+#include "particle_system.h"
+#include "anim_clip.h"
+
+// ============================================================================
+// EYE EXPRESSIONS - Compile-time expression table indexed by BehaviorId
+// ============================================================================
+// Geometry and timing come straight from the BEHAVIORS[] row; this table only
+// adds what the eye engine needs on top (effect overlay, easing curves and
+// the weights of the blink / gaze layers, see eye_layers.h).
+// EyeEngine::setTarget() is a single array lookup: adding an expression is
+// adding data here, no code and no string compares.
+
+enum EyeEffect : uint8_t {
+  EFFECT_NONE,
+  EFFECT_HEART,
+  EFFECT_STARS,
+  EFFECT_SPARKLE,
+  EFFECT_ZZZ,
+  EFFECT_QUESTION,
+  EFFECT_THINKING_DOTS,
+  EFFECT_SCAN_BEAM
+};
+
+// Effect overlays as particle emitters. Positions are relative to the right
+// eye centre (EFFECT_ANCHOR); the scan beam also covers the left eye.
+static const int EFFECT_ANCHOR_X = 96;
+static const int EFFECT_ANCHOR_Y = 32;
+
+//  kind             x    y   stepX stepY slots  vx   vy   life  every delay size glyphs
+static constexpr EmitterDef FX_HEART[] = {
+  {PK_HEART,        22,  12,   0,   0,   1,    0, -15, 2000, 1500,    0, 0, nullptr},
+};
+static constexpr EmitterDef FX_STARS[] = {   // single burst flying outwards
+  {PK_GLYPH_BIG,    12, -10,   0,   0,   1,   15,  -7, 1000,    0,    0, 0, "*"},
+  {PK_GLYPH_BIG,    12,  10,   0,   0,   1,   15,   7, 1000,    0,    0, 0, "*"},
+  {PK_GLYPH_BIG,    18,   0,   0,   0,   1,    0,   0, 1000,    0,    0, 0, "*"},
+};
+static constexpr EmitterDef FX_SPARKLE[] = { // three twinkles on their own rates
+  {PK_SPARKLE,      22, -12,   0,   0,   1,    0,   0,  200,  333,    0, 4, nullptr},
+  {PK_SPARKLE,      30,  -2,   0,   0,   1,    0,   0,  300,  500,  350, 5, nullptr},
+  {PK_SPARKLE,      24,  10,   0,   0,   1,    0,   0,  240,  400,  120, 3, nullptr},
+};
+static constexpr EmitterDef FX_ZZZ[] = {
+  {PK_GLYPH,         8, -12,   8,   0,   3,    0,  -8, 3000, 1000,    0, 0, "zZz"},
+};
+static constexpr EmitterDef FX_QUESTION[] = {
+  {PK_GLYPH_BIG,    20,  -7,   0,   0,   1,    0, -15, 1130, 2333,    0, 0, "?"},
+};
+static constexpr EmitterDef FX_THINKING_DOTS[] = { // thought bubble: dots pop up in a rising row
+  {PK_DOT,          18, -16,   6,  -4,   3,    0,  -2, 1200,  400,    0, 2, nullptr},
+};
+static constexpr EmitterDef FX_SCAN_BEAM[] = { // beam sweeping down both eyes
+  {PK_BEAM,          0, -22,   0,   0,   1,    0,  44, 1000, 1300,    0, 15, nullptr},
+  {PK_BEAM,        -64, -22,   0,   0,   1,    0,  44, 1000, 1300,    0, 15, nullptr},
+};
+
+struct EyeEffectDef {
+  const EmitterDef* emitters;
+  uint8_t count;
+};
+
+#define FX(arr) { arr, (uint8_t)(sizeof(arr) / sizeof(arr[0])) }
+static constexpr EyeEffectDef EYE_EFFECTS[] = {
+  { nullptr, 0 },          // EFFECT_NONE
+  FX(FX_HEART),
+  FX(FX_STARS),
+  FX(FX_SPARKLE),
+  FX(FX_ZZZ),
+  FX(FX_QUESTION),
+  FX(FX_THINKING_DOTS),
+  FX(FX_SCAN_BEAM),
+};
+#undef FX
+static_assert(sizeof(EYE_EFFECTS) / sizeof(EYE_EFFECTS[0]) == EFFECT_SCAN_BEAM + 1,
+              "EYE_EFFECTS[] needs one row per EyeEffect");
+
+enum EaseCurve : uint8_t {
+  EASE_LINEAR,
+  EASE_SMOOTH,    // smoothstep in/out
+  EASE_OUT,       // cubic: fast start, soft landing (snappy reactions)
+  EASE_IN         // cubic: slow start (drowsy lids)
+};
+
+// Base eye size that Behavior::scaleX / openness multiply
+static constexpr float EYE_BASE_WIDTH = 28.0f;
+static constexpr float EYE_BASE_HEIGHT = 40.0f;
+
+struct EyeExpression {
+  BehaviorId id;
+  uint8_t width;          // px
+  uint8_t height;         // px
+  float topLid;           // 0.0 (open) to 1.0 (closed)
+  float bottomLid;
+  int8_t offsetX;         // px
+  int8_t offsetY;
+  EyeEffect effect;
+  ClipId clip;            // pre-rendered clip played on entry (replaces the eyes while it runs)
+  EaseCurve easeShape;    // width / height
+  EaseCurve easeLids;     // top / bottom lid
+  EaseCurve easeGaze;     // offset
+  uint16_t entryMs;       // transition in
+  uint16_t exitMs;        // transition out
+  float blink;            // LAYER_BLINK weight: 0 never blinks, 1 full blinks
+  float gaze;             // LAYER_GAZE weight: how far idle saccades dart
+};
+
+constexpr uint8_t roundPx(float v) {
+  return (uint8_t)(v + 0.5f);
+}
+
+constexpr EyeExpression makeExpression(BehaviorId id, EyeEffect effect, ClipId clip,
+                                       EaseCurve shape, EaseCurve lids, EaseCurve gaze,
+                                       float blinkWeight, float gazeWeight) {
+  return EyeExpression{
+    id,
+    roundPx(EYE_BASE_WIDTH * BEHAVIORS[id].scaleX),
+    roundPx(EYE_BASE_HEIGHT * BEHAVIORS[id].openness),
+    BEHAVIORS[id].topLid,
+    BEHAVIORS[id].bottomLid,
+    (int8_t)BEHAVIORS[id].offsetX,
+    (int8_t)BEHAVIORS[id].offsetY,
+    effect, clip, shape, lids, gaze,
+    BEHAVIORS[id].entryTime,
+    BEHAVIORS[id].exitTime,
+    blinkWeight, gazeWeight
+  };
+}
+
+static constexpr EyeExpression EYE_EXPRESSIONS[BEH_COUNT] = {
+  //             id                     effect                 clip        shape        lids         gaze         blink gaze
+  makeExpression(BEH_CALM_IDLE,         EFFECT_NONE,           CLIP_NONE,  EASE_SMOOTH, EASE_SMOOTH, EASE_SMOOTH, 1.0,  1.0),
+  makeExpression(BEH_SLEEPY_IDLE,       EFFECT_ZZZ,            CLIP_NONE,  EASE_SMOOTH, EASE_IN,     EASE_SMOOTH, 1.0,  0.0),
+  makeExpression(BEH_HAPPY,             EFFECT_HEART,          CLIP_NONE,  EASE_OUT,    EASE_OUT,    EASE_SMOOTH, 1.0,  0.3),
+  makeExpression(BEH_SHY_HAPPY,         EFFECT_HEART,          CLIP_NONE,  EASE_OUT,    EASE_SMOOTH, EASE_SMOOTH, 1.0,  0.3),
+  makeExpression(BEH_SAD,               EFFECT_NONE,           CLIP_NONE,  EASE_SMOOTH, EASE_IN,     EASE_SMOOTH, 1.0,  0.3),
+  makeExpression(BEH_ANGRY,             EFFECT_NONE,           CLIP_NONE,  EASE_OUT,    EASE_OUT,    EASE_OUT,    0.5,  0.0),
+  makeExpression(BEH_SURPRISED,         EFFECT_STARS,          CLIP_NONE,  EASE_OUT,    EASE_OUT,    EASE_OUT,    0.0,  0.0),
+  makeExpression(BEH_CONFUSED,          EFFECT_QUESTION,       CLIP_NONE,  EASE_SMOOTH, EASE_SMOOTH, EASE_SMOOTH, 1.0,  0.5),
+  makeExpression(BEH_CURIOUS_IDLE,      EFFECT_SPARKLE,        CLIP_NONE,  EASE_OUT,    EASE_SMOOTH, EASE_SMOOTH, 1.0,  1.0),
+  makeExpression(BEH_LISTENING,         EFFECT_SCAN_BEAM,      CLIP_NONE,  EASE_OUT,    EASE_SMOOTH, EASE_SMOOTH, 1.0,  0.5),
+  makeExpression(BEH_THINKING,          EFFECT_THINKING_DOTS,  CLIP_NONE,  EASE_SMOOTH, EASE_SMOOTH, EASE_SMOOTH, 1.0,  0.5),
+  makeExpression(BEH_SPEAKING,          EFFECT_NONE,           CLIP_NONE,  EASE_SMOOTH, EASE_SMOOTH, EASE_SMOOTH, 1.0,  0.5),
+  makeExpression(BEH_SLEEPING,          EFFECT_ZZZ,            CLIP_NONE,  EASE_IN,     EASE_IN,     EASE_SMOOTH, 0.0,  0.0),
+  makeExpression(BEH_STARTLED,          EFFECT_STARS,          CLIP_NONE,  EASE_OUT,    EASE_OUT,    EASE_OUT,    0.0,  0.0),
+  makeExpression(BEH_PLAYFUL_MISCHIEF,  EFFECT_SPARKLE,        CLIP_NONE,  EASE_SMOOTH, EASE_OUT,    EASE_SMOOTH, 1.0,  1.0),
+  makeExpression(BEH_WAKE_UP,           EFFECT_NONE,           CLIP_BOOT,  EASE_OUT,    EASE_OUT,    EASE_SMOOTH, 1.0,  0.0),
+  makeExpression(BEH_RANDOM_MOVEMENT,   EFFECT_NONE,           CLIP_NONE,  EASE_SMOOTH, EASE_SMOOTH, EASE_SMOOTH, 1.0,  1.0),
+};
+
+constexpr bool expressionIdsInOrder(int i) {
+  return i == BEH_COUNT || (EYE_EXPRESSIONS[i].id == i && expressionIdsInOrder(i + 1));
+}
+static_assert(expressionIdsInOrder(0), "EYE_EXPRESSIONS[] rows must be in BehaviorId order");
+
+// Eased progress for a linear progress t, both Q16 in [0, 1]
+inline q16_t applyEase(EaseCurve curve, q16_t t) {
+  if (t <= 0) return 0;
+  if (t >= Q16_ONE) return Q16_ONE;
+  switch (curve) {
+    case EASE_SMOOTH: return q16Smoothstep(t);
+    case EASE_OUT: { q16_t u = Q16_ONE - t; return Q16_ONE - q16Mul(q16Mul(u, u), u); }
+    case EASE_IN: return q16Mul(q16Mul(t, t), t);
+    case EASE_LINEAR:
+    default: return t;
+  }
+}
+
+#endif
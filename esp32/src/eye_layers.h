@@ -0,0 +1,132 @@
+#ifndef EYE_LAYERS_H
+#define EYE_LAYERS_H
+
+#include <Arduino.h>
+#include "fixed_math.h"
+
+// Everything that shapes one eye on screen, integrated once per fixed tick.
+// Q16.16 throughout so ticks and render interpolation stay integer-only.
+struct EyeParams {
+  q16_t width = q16(28.0f);    // px
+  q16_t height = q16(40.0f);
+  q16_t offsetX = 0;
+  q16_t offsetY = 0;
+  q16_t topLid = 0;            // 0.0 (open) to 1.0 (closed)
+  q16_t bottomLid = 0;
+  q16_t saccadeX = 0;
+  q16_t saccadeY = 0;
+  q16_t blink = Q16_ONE;       // 1.0 open, 0.0 shut
+
+  static EyeParams lerp(const EyeParams& a, const EyeParams& b, q16_t t) {
+    EyeParams o;
+    o.width = q16Lerp(a.width, b.width, t);
+    o.height = q16Lerp(a.height, b.height, t);
+    o.offsetX = q16Lerp(a.offsetX, b.offsetX, t);
+    o.offsetY = q16Lerp(a.offsetY, b.offsetY, t);
+    o.topLid = q16Lerp(a.topLid, b.topLid, t);
+    o.bottomLid = q16Lerp(a.bottomLid, b.bottomLid, t);
+    o.saccadeX = q16Lerp(a.saccadeX, b.saccadeX, t);
+    o.saccadeY = q16Lerp(a.saccadeY, b.saccadeY, t);
+    o.blink = q16Lerp(a.blink, b.blink, t);
+    return o;
+  }
+};
+
+// ============================================================================
+// EYE LAYERS - Weighted blend stack that produces the eye state each tick
+// ============================================================================
+// Every source of eye motion writes its own layer instead of EyeParams
+// directly; evaluate() folds the stack, bottom to top, into one EyeParams:
+//
+//   LAYER_EXPRESSION  replace   eased morph towards the expression table row
+//   LAYER_GAZE        add       saccade darts
+//   LAYER_BLINK       multiply  blink curve
+//   LAYER_OVERRIDE    replace   external control (lip-sync, scripted looks),
+//                               weight 0 unless someone drives it
+//
+// A layer only touches the fields in its mask, and its weight scales the
+// effect: replace lerps towards the layer value, add adds value * weight,
+// multiply scales by lerp(1, value, weight). Weights come from the
+// expression table (blink / gaze columns), so whether an expression blinks
+// or darts its eyes is data rather than another condition in tick().
+
+enum EyeBlendMode : uint8_t {
+  BLEND_REPLACE,
+  BLEND_ADD,
+  BLEND_MULTIPLY
+};
+
+enum EyeLayerId : uint8_t {
+  LAYER_EXPRESSION,
+  LAYER_GAZE,
+  LAYER_BLINK,
+  LAYER_OVERRIDE,
+  LAYER_COUNT
+};
+
+// Field mask bits, in EyeParams member order
+enum EyeField : uint16_t {
+  FIELD_WIDTH      = 1 << 0,
+  FIELD_HEIGHT     = 1 << 1,
+  FIELD_OFFSET_X   = 1 << 2,
+  FIELD_OFFSET_Y   = 1 << 3,
+  FIELD_TOP_LID    = 1 << 4,
+  FIELD_BOTTOM_LID = 1 << 5,
+  FIELD_SACCADE_X  = 1 << 6,
+  FIELD_SACCADE_Y  = 1 << 7,
+  FIELD_BLINK      = 1 << 8,
+  FIELD_ALL        = 0x1FF
+};
+
+static const uint8_t EYE_PARAM_COUNT = 9;
+static_assert(sizeof(EyeParams) == EYE_PARAM_COUNT * sizeof(q16_t),
+              "EyeLayerStack walks EyeParams as a flat q16_t array");
+
+struct EyeLayer {
+  EyeParams value;
+  q16_t weight = 0;
+  EyeBlendMode mode = BLEND_REPLACE;
+  uint16_t fields = 0;
+};
+
+class EyeLayerStack {
+public:
+  EyeLayerStack() {
+    layers_[LAYER_EXPRESSION].mode = BLEND_REPLACE;
+    layers_[LAYER_EXPRESSION].fields = FIELD_ALL;
+    layers_[LAYER_EXPRESSION].weight = Q16_ONE;
+    layers_[LAYER_GAZE].mode = BLEND_ADD;
+    layers_[LAYER_GAZE].fields = FIELD_SACCADE_X | FIELD_SACCADE_Y;
+    layers_[LAYER_BLINK].mode = BLEND_MULTIPLY;
+    layers_[LAYER_BLINK].fields = FIELD_BLINK;
+    layers_[LAYER_OVERRIDE].mode = BLEND_REPLACE;
+  }
+
+  EyeLayer& operator[](EyeLayerId id) { return layers_[id]; }
+  const EyeLayer& operator[](EyeLayerId id) const { return layers_[id]; }
+
+  // One pass over the stack; layers with weight 0 cost a compare
+  void evaluate(EyeParams& out) const {
+    out = EyeParams();
+    q16_t* o = reinterpret_cast<q16_t*>(&out);
+    for (uint8_t l = 0; l < LAYER_COUNT; l++) {
+      const EyeLayer& layer = layers_[l];
+      const q16_t w = layer.weight;
+      if (w <= 0 || !layer.fields) continue;
+      const q16_t* v = reinterpret_cast<const q16_t*>(&layer.value);
+      for (uint8_t i = 0; i < EYE_PARAM_COUNT; i++) {
+        if (!(layer.fields & (1u << i))) continue;
+        switch (layer.mode) {
+          case BLEND_REPLACE:  o[i] += q16Mul(v[i] - o[i], w); break;
+          case BLEND_ADD:      o[i] += q16Mul(v[i], w); break;
+          case BLEND_MULTIPLY: o[i] = q16Mul(o[i], Q16_ONE + q16Mul(v[i] - Q16_ONE, w)); break;
+        }
+      }
+    }
+  }
+
+private:
+  EyeLayer layers_[LAYER_COUNT];
+};
+
+#endif
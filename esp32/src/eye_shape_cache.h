@@ -0,0 +1,138 @@
+#ifndef EYE_SHAPE_CACHE_H
+#define EYE_SHAPE_CACHE_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// EYE SHAPE CACHE - Pre-rasterized eye masks in SH1106 page layout
+// ============================================================================
+// An eye is a rounded box minus the top/bottom lid bands, and (w, h, r, lids)
+// only take a few dozen integer values. Instead of drawRBox + drawBox per
+// pixel every frame, each shape is rasterized once into a small LRU cache.
+//
+// A mask column is one uint64_t: bit n = pixel row n of the eye, which is
+// exactly the SH1106 vertical-byte layout of 8 stacked pages. Blitting at
+// (x, y) is one 64-bit shift per column, then the 8 page bytes are OR'ed
+// into the U8g2 full buffer.
+
+struct EyeShapeCacheStats {
+  uint32_t hits = 0;
+  uint32_t misses = 0;   // shape rasterized (and LRU entry evicted)
+};
+
+class EyeShapeCache {
+public:
+  static const uint8_t ENTRIES = 4;   // 2 eyes x (current + transition) shapes
+  static const uint8_t MAX_W = 40;    // drawEye clamps width to 20..40
+  static const uint8_t MAX_H = 64;
+
+  // Draw the eye shape into a full-frame page buffer (128 x 8 pages).
+  // Caller guarantees 0 <= x <= 128 - w and 0 <= y <= 64 - h.
+  void blit(uint8_t* buf, int x, int y, uint8_t w, uint8_t h, uint8_t r,
+            uint8_t topPx, uint8_t botPx) {
+    const Entry& e = lookup(w, h, r, topPx, botPx);
+    uint8_t* col = buf + x;
+    for (uint8_t c = 0; c < e.w; c++, col++) {
+      uint64_t v = e.cols[c] << y;
+      for (uint8_t p = 0; p < 8 && v; p++, v >>= 8) {
+        col[p * 128] |= (uint8_t)v;
+      }
+    }
+  }
+
+  const EyeShapeCacheStats& stats() const { return stats_; }
+
+private:
+  struct Entry {
+    uint32_t key = 0xFFFFFFFF;
+    uint32_t lastUse = 0;
+    uint8_t w = 0;
+    uint64_t cols[MAX_W];
+  };
+
+  Entry entries_[ENTRIES];
+  uint32_t useCounter_ = 0;
+  EyeShapeCacheStats stats_;
+
+  static uint32_t makeKey(uint8_t w, uint8_t h, uint8_t r, uint8_t topPx, uint8_t botPx) {
+    return ((uint32_t)w << 24) | ((uint32_t)h << 16) | ((uint32_t)r << 12) |
+           ((uint32_t)(topPx & 0x3F) << 6) | (botPx & 0x3F);
+  }
+
+  const Entry& lookup(uint8_t w, uint8_t h, uint8_t r, uint8_t topPx, uint8_t botPx) {
+    const uint32_t key = makeKey(w, h, r, topPx, botPx);
+    useCounter_++;
+
+    Entry* victim = &entries_[0];
+    for (uint8_t i = 0; i < ENTRIES; i++) {
+      if (entries_[i].key == key) {
+        entries_[i].lastUse = useCounter_;
+        stats_.hits++;
+        return entries_[i];
+      }
+      if (entries_[i].lastUse < victim->lastUse) victim = &entries_[i];
+    }
+
+    stats_.misses++;
+    rasterize(*victim, w, h, r, topPx, botPx);
+    victim->key = key;
+    victim->lastUse = useCounter_;
+    return *victim;
+  }
+
+  // Bits lo..hi (inclusive) set
+  static uint64_t bitRange(int lo, int hi) {
+    if (hi < lo) return 0;
+    uint64_t upper = (hi >= 63) ? ~0ULL : ((1ULL << (hi + 1)) - 1);
+    return upper & ~((1ULL << lo) - 1);
+  }
+
+  // Same geometry as U8g2's drawRBox: four midpoint-circle quarter discs
+  // centred r pixels in from each corner, joined by boxes. Each primitive
+  // is OR'ed into the column masks so overlapping discs on very flat eyes
+  // (r = h/2) come out exactly as U8g2 draws them.
+  static void rasterize(Entry& e, uint8_t w, uint8_t h, uint8_t r,
+                        uint8_t topPx, uint8_t botPx) {
+    if (w > MAX_W) w = MAX_W;
+    if (h > MAX_H) h = MAX_H;
+
+    // reach[d]: how far the quarter disc extends vertically at column
+    // distance d from its centre (u8g2_draw_disc_section vertical lines)
+    uint8_t reach[MAX_H / 2 + 1];
+    memset(reach, 0, sizeof(reach));
+    int f = 1 - r, ddFx = 1, ddFy = -2 * r, cx = 0, cy = r;
+    reach[0] = r;
+    while (cx < cy) {
+      if (f >= 0) { cy--; ddFy += 2; f += ddFy; }
+      cx++; ddFx += 2; f += ddFx;
+      if (reach[cx] < cy) reach[cx] = cy;
+      if (reach[cy] < cx) reach[cy] = cx;
+    }
+
+    const int yu = r;               // upper disc centre row
+    const int yl = (int)h - r - 1;  // lower disc centre row
+    const int xl = r;               // left disc centre column
+    const int xr = (int)w - r - 1;  // right disc centre column
+    const uint64_t capRows = bitRange(0, r) | bitRange(yl, yl + r);
+    const uint64_t midRows = ((int)h - 2 * r >= 3) ? bitRange(r + 1, (int)h - r - 2) : 0;
+    const bool caps = ((int)w - 2 * r >= 3);
+
+    // Lids carve rows [0, topPx) and [h - botPx, h) out of every column
+    const uint64_t lidMask = bitRange(topPx, (int)h - 1 - botPx);
+
+    e.w = w;
+    for (int c = 0; c < w; c++) {
+      uint64_t col = midRows;
+      if (caps && c > xl && c < xr) col |= capRows;
+
+      int dl = xl - c;  // distance to the left disc centre (if on its side)
+      int dr = c - xr;
+      if (dl >= 0 && dl <= r) col |= bitRange(yu - reach[dl], yu) | bitRange(yl, yl + reach[dl]);
+      if (dr >= 0 && dr <= r) col |= bitRange(yu - reach[dr], yu) | bitRange(yl, yl + reach[dr]);
+
+      e.cols[c] = col & lidMask & bitRange(0, (int)h - 1);
+    }
+  }
+};
+
+#endif
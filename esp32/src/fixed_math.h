@@ -0,0 +1,91 @@
+#ifndef FIXED_MATH_H
+#define FIXED_MATH_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// FIXED MATH - Q16.16 helpers and a quarter-wave sine table
+// ============================================================================
+// Animation code runs every tick and every frame, and the ESP32 FPU is slow
+// at sinf()/fmodf()/divides (and not usable from every context). Everything
+// the eye and LED animations need per frame is here in integer form:
+//
+//   q16_t      signed Q16.16, 1.0 == Q16_ONE
+//   phase      uint16_t fraction of a turn, 65536 == one full period
+//   q16 time   uint32_t Q16 seconds; wraps after ~18 h, which only matters
+//              for periods that don't divide 65536 s (one phase jump per wrap)
+
+typedef int32_t q16_t;
+
+static const q16_t Q16_ONE = 65536;
+static const q16_t Q16_HALF = 32768;
+
+// Usable in constant expressions (thresholds, table values)
+constexpr q16_t q16(float f) {
+  return (q16_t)(f * 65536.0f + (f >= 0.0f ? 0.5f : -0.5f));
+}
+
+inline q16_t q16FromFloat(float f) { return q16(f); }
+inline float q16ToFloat(q16_t v) { return v / 65536.0f; }
+inline q16_t q16FromInt(int v) { return (q16_t)v << 16; }
+
+// Truncates toward zero, same as an (int) cast of the float value
+inline int q16ToInt(q16_t v) { return v >= 0 ? (v >> 16) : -((-v) >> 16); }
+
+inline q16_t q16Mul(q16_t a, q16_t b) { return (q16_t)(((int64_t)a * b) >> 16); }
+inline q16_t q16Div(q16_t a, q16_t b) { return (q16_t)(((int64_t)a << 16) / b); }
+
+inline q16_t q16Lerp(q16_t a, q16_t b, q16_t t) { return a + q16Mul(b - a, t); }
+
+inline q16_t q16Clamp01(q16_t t) {
+  return t < 0 ? 0 : (t > Q16_ONE ? Q16_ONE : t);
+}
+
+// t * t * (3 - 2t), t clamped to [0, 1]
+inline q16_t q16Smoothstep(q16_t t) {
+  t = q16Clamp01(t);
+  return q16Mul(q16Mul(t, t), 3 * Q16_ONE - 2 * t);
+}
+
+// Seconds -> wrapping Q16 time (see header note)
+inline uint32_t q16Time(float seconds) {
+  return (uint32_t)(int64_t)(seconds * 65536.0f);
+}
+
+// Q16 cycles elapsed after time tq at frequency hz: integer part = cycle
+// count, low 16 bits = phase within the cycle. Replaces fmod(t * hz, 1).
+inline uint32_t q16Cycles(uint32_t tq, q16_t hz) {
+  return (uint32_t)(((uint64_t)tq * (uint32_t)hz) >> 16);
+}
+
+// sin(2*pi * q), q = 0..64 over the first quarter turn, scaled to 65535
+static const uint16_t SINE_QUARTER_LUT[65] = {
+      0,  1608,  3216,  4821,  6424,  8022,  9616, 11204,
+  12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+  25079, 26557, 28020, 29465, 30893, 32302, 33692, 35061,
+  36409, 37736, 39039, 40319, 41575, 42806, 44011, 45189,
+  46340, 47464, 48558, 49624, 50659, 51664, 52638, 53580,
+  54490, 55367, 56211, 57021, 57797, 58537, 59243, 59913,
+  60546, 61144, 61704, 62227, 62713, 63161, 63571, 63943,
+  64276, 64570, 64826, 65042, 65219, 65357, 65456, 65515,
+  65535,
+};
+
+// sin() of a phase (1/65536 turn units), result in Q16 [-1, 1].
+// Quarter-wave symmetry + linear interpolation, max error ~1.2e-4.
+inline q16_t q16Sin(uint16_t phase) {
+  uint16_t i = phase & 0x3FFF;               // position in the quarter, 14 bits
+  if (phase & 0x4000) i = 0x4000 - i;        // 2nd/4th quarter run backwards
+  uint8_t idx = i >> 8;
+  uint8_t frac = i & 0xFF;
+  int32_t v = SINE_QUARTER_LUT[idx];
+  if (frac) v += ((SINE_QUARTER_LUT[idx + 1] - v) * frac) >> 8;
+  return (phase & 0x8000) ? -v : v;
+}
+
+inline q16_t q16Cos(uint16_t phase) { return q16Sin((uint16_t)(phase + 0x4000)); }
+
+// (sin + 1) / 2, the 0..1 "wave" most animations want
+inline q16_t q16Wave(uint16_t phase) { return (q16Sin(phase) + Q16_ONE) >> 1; }
+
+#endif
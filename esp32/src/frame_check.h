@@ -0,0 +1,152 @@
+#ifndef FRAME_CHECK_H
+#define FRAME_CHECK_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "config.h"
+#include "behaviors.h"
+#include "eye_engine.h"
+#include "golden_frames.h"
+
+// ============================================================================
+// FRAME CHECK - Headless EyeEngine run against golden frames
+// ============================================================================
+// Builds an EyeEngine on a memory-only SH1106 (same U8g2 setup as the real
+// panel, but the byte callback drops everything). Every behavior is played
+// on a simulated fixed clock from a fixed random seed; frames sampled at
+// GOLDEN_TICKS are hashed and compared with golden_frames.h, and the
+// rasterize / full render cost is reported per behavior (CPU only, no I2C).
+//
+// Built for Linux by esp32/host (ctest runs it before anything is flashed);
+// any mismatching or unrecorded frame fails the run.
+
+// SH1106 full-buffer display that never touches the bus
+class U8G2_SH1106_128X64_HEADLESS : public U8G2 {
+public:
+  U8G2_SH1106_128X64_HEADLESS() : U8G2() {
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  }
+};
+
+// Page-buffer counterpart, for comparing the two render paths
+class U8G2_SH1106_128X64_HEADLESS_PAGED : public U8G2 {
+public:
+  U8G2_SH1106_128X64_HEADLESS_PAGED() : U8G2() {
+    u8g2_Setup_sh1106_i2c_128x64_noname_1(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  }
+};
+
+namespace FrameCheck {
+
+static const uint32_t RASTER_BUDGET_US = 2000;   // flag behaviors slower than this
+
+inline uint32_t frameHash(const uint8_t* buf) {
+  uint32_t h = 2166136261UL;  // FNV-1a
+  for (int i = 0; i < 1024; i++) {
+    h ^= buf[i];
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+// Plain PGM (P2), one pixel per value; tools/extract_pgm.py cuts these out of
+// the output into .pgm files
+inline void dumpPgm(const uint8_t* buf, const char* name, uint16_t tick) {
+  Serial.printf("[PGM] %s_%03u.pgm\nP2\n128 64\n1\n", name, tick);
+  char line[2 * 128 + 1];
+  for (int y = 0; y < 64; y++) {
+    const uint8_t* page = buf + (y >> 3) * 128;
+    for (int x = 0; x < 128; x++) {
+      line[2 * x] = ((page[x] >> (y & 7)) & 1) ? '1' : '0';
+      line[2 * x + 1] = ' ';
+    }
+    line[2 * 128] = '\0';
+    Serial.println(line);
+  }
+  Serial.println("[PGM END]");
+}
+
+// Returns the number of mismatching or unrecorded frames. dumpAll: print
+// every sampled frame as PGM, not only the mismatches.
+inline int run(float tickDt, bool dumpAll = false) {
+  Serial.println("\n[FRAMES] ===== Headless golden-frame check =====");
+
+  U8G2_SH1106_128X64_HEADLESS* display = new U8G2_SH1106_128X64_HEADLESS();
+  display->begin();
+  EyeEngine* eye = new EyeEngine(*display);
+  eye->setTickInterval(tickDt);
+
+  int mismatches = 0, unrecorded = 0;
+  for (uint8_t id = 0; id < BEH_COUNT; id++) {
+    const char* name = BEHAVIORS[id].name;
+    const uint32_t* golden = GOLDEN_FRAMES[id];
+    bool recorded = false;
+    for (uint8_t k = 0; k < GOLDEN_SAMPLES; k++) {
+      if (golden[k] != 0) recorded = true;
+    }
+
+    // Same starting point for every behavior, independent of the others
+    randomSeed(GOLDEN_SEED + id);
+    eye->startBootSequence();
+    eye->stopClip();                 // boot clip would cover every behavior's first second
+    eye->setTarget((BehaviorId)id);
+
+    uint32_t hashes[GOLDEN_SAMPLES];
+    uint32_t rasterUs = 0, rasterMax = 0, renderUs = 0, renderMax = 0;
+    uint16_t tick = 0;
+    for (uint8_t k = 0; k < GOLDEN_SAMPLES; k++) {
+      while (tick < GOLDEN_TICKS[k]) {
+        eye->tick(tickDt);
+        tick++;
+      }
+      EyeFrame f = eye->snapshot();
+
+      uint32_t start = micros();
+      eye->rasterize(f);
+      uint32_t raster = micros() - start;
+      hashes[k] = frameHash(display->getBufferPtr());
+
+      start = micros();
+      eye->renderFrame(f);
+      uint32_t render = micros() - start;
+
+      rasterUs += raster;
+      renderUs += render;
+      if (raster > rasterMax) rasterMax = raster;
+      if (render > renderMax) renderMax = render;
+
+      bool bad = recorded && hashes[k] != golden[k];
+      if (bad) {
+        mismatches++;
+        Serial.printf("[FRAMES] MISMATCH %s tick %u: got %08lx want %08lx\n", name, tick,
+                      (unsigned long)hashes[k], (unsigned long)golden[k]);
+      }
+      if (bad || dumpAll) dumpPgm(display->getBufferPtr(), name, tick);
+    }
+
+    Serial.printf("[FRAMES] %-18s %s raster avg=%4luus max=%4luus render avg=%4luus max=%4luus%s\n",
+                  name, recorded ? "checked " : "NO GOLD ",
+                  (unsigned long)(rasterUs / GOLDEN_SAMPLES), (unsigned long)rasterMax,
+                  (unsigned long)(renderUs / GOLDEN_SAMPLES), (unsigned long)renderMax,
+                  rasterMax > RASTER_BUDGET_US ? "  SLOW" : "");
+    if (!recorded) {
+      unrecorded++;
+      Serial.print("[GOLDEN]  {");
+      for (uint8_t k = 0; k < GOLDEN_SAMPLES; k++) {
+        Serial.printf(" 0x%08lx%s", (unsigned long)hashes[k], k + 1 < GOLDEN_SAMPLES ? "," : "");
+      }
+      Serial.printf(" },  // %s\n", name);
+    }
+  }
+
+  Serial.printf("[FRAMES] %s: %d mismatching frames, %d behaviors without golden frames\n",
+                (mismatches || unrecorded) ? "FAIL" : "PASS", mismatches, unrecorded);
+
+  delete eye;
+  delete display;
+  return mismatches + unrecorded * GOLDEN_SAMPLES;
+}
+
+} // namespace FrameCheck
+
+#endif
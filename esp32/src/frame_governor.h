@@ -0,0 +1,168 @@
+#ifndef FRAME_GOVERNOR_H
+#define FRAME_GOVERNOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// FRAME GOVERNOR - Steps eye quality down when loop() runs over budget
+// ============================================================================
+// loop() times its heavy sections (frame publish/render, MP3 decode,
+// websocket, LEDs) into the governor. Every GOVERNOR_WINDOW_MS the window is
+// judged against GOVERNOR_LOOP_BUDGET_US:
+//
+//   too many iterations over budget, or average above 3/4 of it
+//       -> one quality level down (immediately, next window can go further)
+//   average under 1/2 of the budget with no overruns for
+//   GOVERNOR_RECOVER_WINDOWS windows in a row
+//       -> one level back up
+//
+// The asymmetric hysteresis keeps it from flapping when audio decode sits
+// right at the limit. Levels are data (QUALITY_PROFILES); the caller applies
+// the profile whenever endLoop() reports a change.
+
+enum LoopSection : uint8_t {
+  SECTION_RENDER,   // eye snapshot publish / inline render
+  SECTION_AUDIO,    // audioMgr.update(), mic blocks + spectrum
+  SECTION_WS,       // robotWs.loop() + message handling
+  SECTION_LEDS,     // LED tick + render
+  SECTION_COUNT
+};
+
+static const char* const LOOP_SECTION_NAMES[SECTION_COUNT] = { "render", "audio", "ws", "leds" };
+
+enum QualityLevel : uint8_t {
+  QUALITY_FULL,
+  QUALITY_REDUCED,
+  QUALITY_LOW,
+  QUALITY_MINIMAL,
+  QUALITY_COUNT
+};
+
+struct QualityProfile {
+  QualityLevel level;
+  const char* name;
+  uint8_t maxParticles;   // effect particle pool limit
+  uint8_t renderFps;      // OLED + LED output rate
+  bool saccades;          // idle eye darts
+};
+
+static const QualityProfile QUALITY_PROFILES[QUALITY_COUNT] = {
+  { QUALITY_FULL,    "full",    24, RENDER_FPS, true  },
+  { QUALITY_REDUCED, "reduced", 12, 24,         true  },
+  { QUALITY_LOW,     "low",      6, 20,         false },
+  { QUALITY_MINIMAL, "minimal",  3, 15,         false },
+};
+
+struct GovernorStats {
+  uint32_t levelMs[QUALITY_COUNT] = {};   // time spent at each level
+  uint32_t stepsDown = 0;
+  uint32_t stepsUp = 0;
+  uint32_t sectionAvgUs[SECTION_COUNT] = {}; // last window, per loop iteration
+  uint32_t sectionMaxUs[SECTION_COUNT] = {}; // last window, worst single iteration
+  uint32_t loopAvgUs = 0;                 // last window, sum of all sections
+  uint8_t overBudgetPct = 0;              // last window, iterations over budget
+};
+
+class FrameGovernor {
+public:
+  void begin(uint32_t budgetUs) {
+    budgetUs_ = budgetUs;
+    windowStartMs_ = millis();
+    resetWindow();
+    Serial.printf("[GOVERNOR] Loop budget %luus, window %dms\n", (unsigned long)budgetUs_, GOVERNOR_WINDOW_MS);
+  }
+
+  // Time a section: uint32_t t = micros(); ...; governor.add(SECTION_X, t);
+  void add(LoopSection section, uint32_t startUs) {
+    uint32_t us = micros() - startUs;
+    iterUs_[section] += us;
+  }
+
+  // Call once at the end of loop(); returns true if the level changed
+  bool endLoop() {
+    uint32_t total = 0;
+    for (uint8_t s = 0; s < SECTION_COUNT; s++) {
+      total += iterUs_[s];
+      windowUs_[s] += iterUs_[s];
+      if (iterUs_[s] > windowMaxUs_[s]) windowMaxUs_[s] = iterUs_[s];
+      iterUs_[s] = 0;
+    }
+    windowLoops_++;
+    windowTotalUs_ += total;
+    if (total > budgetUs_) windowOver_++;
+
+    unsigned long now = millis();
+    if (now - windowStartMs_ < GOVERNOR_WINDOW_MS) return false;
+    stats_.levelMs[level_] += now - windowStartMs_;
+    windowStartMs_ = now;
+    return evaluate();
+  }
+
+  QualityLevel level() const { return level_; }
+  const QualityProfile& profile() const { return QUALITY_PROFILES[level_]; }
+  const GovernorStats& stats() const { return stats_; }
+
+private:
+  uint32_t budgetUs_ = 10000;
+  QualityLevel level_ = QUALITY_FULL;
+  uint8_t calmWindows_ = 0;
+
+  uint32_t iterUs_[SECTION_COUNT] = {};
+  uint32_t windowUs_[SECTION_COUNT] = {};
+  uint32_t windowMaxUs_[SECTION_COUNT] = {};
+  uint32_t windowTotalUs_ = 0;
+  uint32_t windowLoops_ = 0;
+  uint32_t windowOver_ = 0;
+  unsigned long windowStartMs_ = 0;
+
+  GovernorStats stats_;
+
+  bool evaluate() {
+    const uint32_t loops = windowLoops_ ? windowLoops_ : 1;
+    const uint32_t avg = windowTotalUs_ / loops;
+    const uint8_t overPct = (uint8_t)(windowOver_ * 100 / loops);
+
+    stats_.loopAvgUs = avg;
+    stats_.overBudgetPct = overPct;
+    for (uint8_t s = 0; s < SECTION_COUNT; s++) {
+      stats_.sectionAvgUs[s] = windowUs_[s] / loops;
+      stats_.sectionMaxUs[s] = windowMaxUs_[s];
+    }
+    resetWindow();
+
+    QualityLevel next = level_;
+    if (overPct > GOVERNOR_OVER_PCT || avg > budgetUs_ * 3 / 4) {
+      calmWindows_ = 0;
+      if (level_ + 1 < QUALITY_COUNT) next = (QualityLevel)(level_ + 1);
+    } else if (overPct == 0 && avg < budgetUs_ / 2) {
+      if (level_ > QUALITY_FULL && ++calmWindows_ >= GOVERNOR_RECOVER_WINDOWS) {
+        calmWindows_ = 0;
+        next = (QualityLevel)(level_ - 1);
+      }
+    } else {
+      calmWindows_ = 0;
+    }
+
+    if (next == level_) return false;
+    if (next > level_) stats_.stepsDown++;
+    else stats_.stepsUp++;
+    Serial.printf("[GOVERNOR] %s -> %s (loop avg %luus, %u%% over budget)\n",
+                  QUALITY_PROFILES[level_].name, QUALITY_PROFILES[next].name,
+                  (unsigned long)avg, overPct);
+    level_ = next;
+    return true;
+  }
+
+  void resetWindow() {
+    for (uint8_t s = 0; s < SECTION_COUNT; s++) {
+      windowUs_[s] = 0;
+      windowMaxUs_[s] = 0;
+    }
+    windowTotalUs_ = 0;
+    windowLoops_ = 0;
+    windowOver_ = 0;
+  }
+};
+
+#endif
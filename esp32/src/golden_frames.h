@@ -0,0 +1,44 @@
+#ifndef GOLDEN_FRAMES_H
+#define GOLDEN_FRAMES_H
+
+#include <Arduino.h>
+#include "behaviors.h"
+
+// ============================================================================
+// GOLDEN FRAMES - Reference frame hashes for FrameCheck (frame_check.h)
+// ============================================================================
+// One row per BehaviorId, one FNV-1a hash of the 1024-byte frame buffer per
+// sample tick, recorded from the host build (esp32/host). A missing row
+// fails the check; FrameCheck prints the hashes it rendered as a
+// ready-to-paste row.
+//
+// To re-record after an intentional visual change: run the host frame_check,
+// copy the "[GOLDEN]" rows over the table below, and eyeball the changed
+// frames (frame_check --pgm, tools/extract_pgm.py; esp32/host/golden holds
+// a few reference PGMs).
+
+static const uint32_t GOLDEN_SEED = 0x5EED;       // randomSeed() per behavior
+static const uint8_t GOLDEN_SAMPLES = 5;
+static const uint16_t GOLDEN_TICKS[GOLDEN_SAMPLES] = { 0, 12, 30, 90, 240 };  // ticks after setTarget
+
+static const uint32_t GOLDEN_FRAMES[BEH_COUNT][GOLDEN_SAMPLES] = {
+  { 0x454b7379, 0x454b7379, 0x454b7379, 0x454b7379, 0xdc66fe51 },  // calm_idle
+  { 0x454b7379, 0x3273dac2, 0xfd58af35, 0x201277c7, 0xaaf2391d },  // sleepy_idle
+  { 0x454b7379, 0x756a247b, 0xb124be91, 0x141ff90d, 0x181f3b6d },  // happy
+  { 0x454b7379, 0x6c2577bb, 0x85c84519, 0x34e4135d, 0x766969bd },  // shy_happy
+  { 0x454b7379, 0xf34faff5, 0x5aec1a11, 0xca9175ad, 0x680c004d },  // sad
+  { 0x454b7379, 0x15db63a5, 0x7c82c1a5, 0x7c82c1a5, 0x7c82c1a5 },  // angry
+  { 0x454b7379, 0x1f2ae988, 0xb6d3dfd6, 0x557171f9, 0x557171f9 },  // surprised
+  { 0x454b7379, 0xaee1ab0a, 0xf6c3fffc, 0xd71e6f25, 0x685b599d },  // confused
+  { 0x454b7379, 0xed4240da, 0x9ae6f4fc, 0x97d5e51f, 0x044813a4 },  // curious_idle
+  { 0x454b7379, 0xd1944f75, 0x076e07dd, 0x90e7d9f5, 0xe848b65d },  // listening
+  { 0x454b7379, 0xd96b7030, 0xd48bac32, 0x33cb68c7, 0x1cff5b75 },  // thinking
+  { 0x454b7379, 0x454b7379, 0x454b7379, 0x454b7379, 0xb3f53559 },  // speaking
+  { 0x454b7379, 0x0fed8b0e, 0x0d395d15, 0x7b7f5cef, 0xc25a7b61 },  // sleeping
+  { 0x454b7379, 0xf6d0ed68, 0x57861d86, 0x53940201, 0x53940201 },  // startled
+  { 0x454b7379, 0x79882262, 0xa62d52ec, 0x4a01415b, 0xba3ef958 },  // playful_mischief
+  { 0x7ef6154d, 0xb227d07d, 0xef7930fd, 0xeaf18085, 0xeaf18085 },  // wake_up
+  { 0x454b7379, 0x2d53b779, 0xec1645f9, 0xec1645f9, 0xec1645f9 },  // random_movement
+};
+
+#endif
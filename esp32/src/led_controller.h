@@ -1,221 +1,425 @@
 #ifndef LED_CONTROLLER_H
 #define LED_CONTROLLER_H
 
-#include <Adafruit_NeoPixel.h>
 #include "pins.h"
+#include "config.h"
+#include "fixed_math.h"
+#include "led_moods.h"
+#include "led_output.h"
+
+// ============================================================================
+// LED CONTROLLER - Mood animations on the WS2812 ring
+// ============================================================================
+// A mood (a LED_MOODS[] row) is a brightness envelope and a per-pixel
+// pattern. Showing one samples the envelope over one period into a 256-entry
+// gamma-corrected level table; the pattern (solid, partial ring, comet,
+// chase, gradient, spinner, spectrum) turns that level into one colour per
+// pixel, drawn straight into the LedOutput back buffer. The buffer is compared
+// with the last frame sent and only committed when it differs - at 8-bit
+// levels the slow breathes and the steady glow repeat most frames.
+//
+// What is shown is the top of a small stack: the base mood at the bottom,
+// transient overlays (the surprise flash, the voice spectrum) above it, each
+// popped when its time runs out. Every change of the top crossfades from the
+// last frame sent to the new mood over a per-transition time, in Q16.
+//
+// Each finished frame is held to a current limit (PowerBudget): the frame's
+// channel sum gives its draw, and a frame over the limit is scaled down as a
+// whole before it is compared and sent, so hue and pattern survive a peak.
+
+static_assert(SPECTRUM_BANDS == NUM_LEDS, "voiceReact() draws one spectrum band per pixel");
+
+struct LedStats {
+  uint32_t shows = 0;       // frames sent to the ring
+  uint32_t skipped = 0;     // frames identical to what the ring shows
+  uint32_t limited = 0;     // frames scaled down to the current limit
+};
 
 class LedController {
 public:
   void begin() {
-    strip_ = Adafruit_NeoPixel(NUM_LEDS, PIN_NEOPIXEL, NEO_GRB + NEO_KHZ800);
-    strip_.begin();
-    strip_.setBrightness(40);
-    strip_.show();
-    
-    // Default to idle
-    setMood("idle");
+    out_.begin();
+    show(stack_[0], 0);
+  }
+
+  // Base mood. Overlay rows (overlayMs in the table) go on top instead.
+  // fadeMs < 0: the mood's own crossfade time.
+  void setMood(LedMoodId id, int16_t fadeMs = -1) {
+    if (id >= MOOD_COUNT) return;
+    if (LED_MOODS[id].overlayMs) {
+      showOverlay(id, LED_MOODS[id].overlayMs, fadeMs);
+      return;
+    }
+    setBase(id, LED_MOODS[id].color, fadeMs);
+  }
+
+  // Any colour as the base mood (MOOD_CUSTOM's envelope)
+  void setColor(uint32_t rgb, int16_t fadeMs = -1) {
+    setBase(MOOD_CUSTOM, rgb, fadeMs);
+  }
+
+  // Show id on top of everything for ms, then go back to what was under it.
+  // Showing the overlay already on top only extends it.
+  void showOverlay(LedMoodId id, uint16_t ms, int16_t fadeMs = -1) {
+    LedLayer& top = stack_[depth_ - 1];
+    if (depth_ > 1 && top.mood == id) {
+      top.remaining = q16FromFloat(ms / 1000.0f);
+      return;
+    }
+    if (depth_ < LED_OVERLAY_DEPTH + 1) depth_++;     // full: replaces the top overlay
+    stack_[depth_ - 1] = { id, LED_MOODS[id].color, q16FromFloat(ms / 1000.0f) };
+    show(stack_[depth_ - 1], fadeMs);
+  }
+
+  // Web UI command: "#rrggbb", or a mood name. False if it is neither.
+  bool command(const char* cmd) {
+    uint32_t rgb;
+    LedMoodId id;
+    if (parseHexColor(cmd, rgb)) setColor(rgb);
+    else if (findLedMood(cmd, id)) setMood(id);
+    else return false;
+    return true;
   }
 
-  void setMood(const char* mood) {
-    // 1. Check if mood is actually changing (Optimization)
-    if (strcmp(mood, currentMood_) == 0) return;
+  LedMoodId mood() const { return stack_[depth_ - 1].mood; }
+
+  // Most the ring may draw from the next frame on, mA
+  void setCurrentLimit(uint16_t mA) { limitMa_ = mA; }
+
+  // Estimated draw of the last frame drawn (what the ring shows), mA
+  uint16_t currentMa() const { return currentMa_; }
+
+  // Fixed-step animation update, called once per AnimClock tick
+  void tick(float dt) {
+    const q16_t dtq = q16FromFloat(dt);
+    stateTimer_ += dt;
+    lastDt_ = dt;
+    if (fadeT_ < Q16_ONE) fadeT_ = min<q16_t>(Q16_ONE, fadeT_ + q16Mul(dtq, fadeRate_));
     
-    // FLASH-ONCE FIX: Save previous mood before setting "surprised" so we can restore
-    if (strcmp(mood, "surprised") == 0 || strcmp(mood, "startled") == 0) {
-      if (strcmp(currentMood_, "surprised") != 0 && strcmp(currentMood_, "startled") != 0) {
-        strncpy(previousMood_, currentMood_, 15);
-        previousMood_[15] = '\0';
+    if (depth_ > 1) {
+      LedLayer& top = stack_[depth_ - 1];
+      top.remaining -= dtq;
+      if (top.remaining <= 0) {
+        depth_--;
+        Serial.printf("[LED] %s done, back to %s\n", LED_MOODS[top.mood].name,
+                      LED_MOODS[stack_[depth_ - 1].mood].name);
+        show(stack_[depth_ - 1], -1);
       }
     }
+  }
+
+  // Push the current frame to the ring. Called at the AnimClock render rate,
+  // which replaces the old private 33ms throttle; alpha interpolates the
+  // animation time between the last two ticks.
+  void render(float alpha = 1.0f) {
+    if (!out_.ready()) {
+      out_.noteRefused();
+      return;
+    }
+    float t = stateTimer_ - (1.0f - alpha) * lastDt_;
+    if (t < 0) t = 0;
+    const uint32_t tq = q16Time(t);
     
-    strncpy(currentMood_, mood, 15);
-    currentMood_[15] = '\0';
-    stateTimer_ = 0; // Reset animation timer
-    flashRestored_ = false; // Reset flash restore flag
-    
-    Serial.printf("[LED] Setting mood: %s\n", mood);
+    // Envelope level x global brightness, 0..65536
+    const uint32_t scale = (uint32_t)(levelAt(tq) + 1) * (LED_MAX_BRIGHTNESS + 1);
+    uint8_t* px = out_.pixels();
+    drawPattern(px, tq, scale);
+    if (fadeT_ < Q16_ONE) crossfade(px);
+    limitCurrent(px);
+    commitIfChanged(px);
     
-    // 2. Configure Colors & Animation Mode
-    if (strcmp(mood, "idle") == 0 || strcmp(mood, "calm_idle") == 0 || strcmp(mood, "cyan") == 0) {
-      targetColor_ = strip_.Color(80, 180, 220);
-      animMode_ = ANIM_IDLE_BREATHE;
-      cycleDuration_ = 3.0f;
-      minBrightness_ = 0.15f; maxBrightness_ = 0.45f;
-      partialRing_ = false;
-    }
-    else if (strcmp(mood, "happy") == 0 || strcmp(mood, "shy_happy") == 0) {
-      targetColor_ = strip_.Color(255, 200, 50);
-      animMode_ = ANIM_GENTLE_PULSE;
-      cycleDuration_ = 3.5f;
-      minBrightness_ = 0.3f; maxBrightness_ = 0.7f;
-      partialRing_ = false;
-    }
-    else if (strcmp(mood, "surprised") == 0 || strcmp(mood, "startled") == 0) {
-      targetColor_ = strip_.Color(255, 255, 255);
-      animMode_ = ANIM_FLASH_ONCE;
-      cycleDuration_ = 0.2f;
-      partialRing_ = false;
-    }
-    else if (strcmp(mood, "sad") == 0 || strcmp(mood, "blue") == 0) {
-      targetColor_ = strip_.Color(40, 60, 180);
-      animMode_ = ANIM_SLOW_BREATHE;
-      cycleDuration_ = 6.0f;
-      minBrightness_ = 0.05f; maxBrightness_ = 0.25f;
-      partialRing_ = false;
-    }
-    else if (strcmp(mood, "sleepy_idle") == 0 || strcmp(mood, "sleeping") == 0 || strcmp(mood, "purple") == 0) {
-      targetColor_ = strip_.Color(80, 60, 140);
-      animMode_ = ANIM_DEEP_BREATHE;
-      cycleDuration_ = 7.0f;
-      minBrightness_ = 0.02f; maxBrightness_ = 0.15f;
-      partialRing_ = true;
-    }
-    else if (strcmp(mood, "angry") == 0 || strcmp(mood, "red") == 0) {
-      targetColor_ = strip_.Color(255, 40, 0);
-      animMode_ = ANIM_SHARP_PULSE;
-      cycleDuration_ = 0.8f;
-      minBrightness_ = 0.2f; maxBrightness_ = 1.0f;
-      partialRing_ = false;
-    }
-    else if (strcmp(mood, "listening") == 0 || strcmp(mood, "green") == 0) {
-      targetColor_ = strip_.Color(0, 255, 100);
-      animMode_ = ANIM_STEADY_GLOW;
-      minBrightness_ = 0.5f; maxBrightness_ = 0.6f;
-      partialRing_ = false;
-    }
-    else if (strcmp(mood, "orange") == 0) {
-      targetColor_ = strip_.Color(255, 140, 0);
-      animMode_ = ANIM_GENTLE_PULSE;
-      cycleDuration_ = 3.0f;
-      minBrightness_ = 0.3f; maxBrightness_ = 0.6f;
-      partialRing_ = false;
-    }
-    else {
-      // Default Fallback
-      targetColor_ = strip_.Color(80, 180, 220);
-      animMode_ = ANIM_IDLE_BREATHE;
+    if (millis() - lastStatsMs_ > LED_STATS_MS) {
+      lastStatsMs_ = millis();
+      const LedOutputStats& o = out_.stats();
+      uint32_t total = stats_.shows + stats_.skipped;
+      Serial.printf("[LED] shows=%lu skipped=%lu (%lu%% of frames) refused=%lu limited=%lu tx=%luus/frame%s\n",
+                    (unsigned long)stats_.shows, (unsigned long)stats_.skipped,
+                    (unsigned long)(total ? stats_.skipped * 100 / total : 0),
+                    (unsigned long)o.refused, (unsigned long)stats_.limited,
+                    (unsigned long)(o.frames ? o.busyUs / o.frames : 0),
+                    out_.async() ? "" : " (blocking)");
     }
   }
 
-  void loop(float dt) {
-    stateTimer_ += dt;
-    
-    // ⚡ CRITICAL FIX: Throttle LED updates to 30 FPS (Every 33ms)
-    // This stops the LEDs from spamming the power rail and confusing the sensors
-    static unsigned long lastLEDUpdate = 0;
-    if (millis() - lastLEDUpdate < 33) return; 
-    lastLEDUpdate = millis();
-
-    uint8_t r = (targetColor_ >> 16) & 0xFF;
-    uint8_t g = (targetColor_ >> 8) & 0xFF;
-    uint8_t b = targetColor_ & 0xFF;
+  // Mic spectrum, one band per pixel (AudioSpectrum::peaks()), shown as the
+  // MOOD_VOICE overlay until LED_VOICE_HOLD_MS after the last call
+  void voiceReact(const uint8_t* bands) {
+    memcpy(voice_, bands, NUM_LEDS);
+    showOverlay(MOOD_VOICE, LED_MOODS[MOOD_VOICE].overlayMs);
+  }
+
+  const LedStats& stats() const { return stats_; }
+
+private:
+  struct LedLayer {
+    LedMoodId mood;
+    uint32_t color;
+    q16_t remaining;    // overlays: time left, s
+  };
+  
+  LedOutput out_;
+  LedLayer stack_[LED_OVERLAY_DEPTH + 1] = { { MOOD_IDLE, LED_MOODS[MOOD_IDLE].color, 0 } };
+  uint8_t depth_ = 1;                   // stack_[0] is the base mood
+  
+  // The mood on screen (top of the stack)
+  LedAnim animMode_ = ANIM_IDLE_BREATHE;
+  LedPattern pattern_ = PATTERN_SOLID;
+  uint32_t targetColor_ = 0;
+  uint32_t secondColor_ = 0;            // PATTERN_GRADIENT / PATTERN_SPECTRUM far end
+  float stateTimer_ = 0.0f;
+  float lastDt_ = 0.0f;
+  
+  // Crossfade from the last frame sent before the top changed
+  uint8_t shown_[LedOutput::BYTES] = {};
+  uint8_t fadeFrom_[LedOutput::BYTES] = {};
+  q16_t fadeT_ = Q16_ONE;
+  q16_t fadeRate_ = Q16_ONE;            // 1 / fade time
+  
+  // Level table for the current mood: one period of calculateBrightness(),
+  // gamma-corrected, 0..255
+  static const uint16_t LEVEL_STEPS = 256;
+  uint8_t levels_[LEVEL_STEPS] = {};
+  q16_t levelHzQ_ = q16(1.0f / 3.0f);   // table periods per second
+  uint8_t flashOn_ = 0;                 // ANIM_FLASH_ONCE isn't periodic
+  uint8_t flashOff_ = 0;
+  
+  uint8_t voice_[NUM_LEDS] = {};        // spectrum bands, 0..255
+  
+  LedStats stats_;
+  uint16_t limitMa_ = 0xFFFF;
+  uint16_t currentMa_ = 0;
+  bool shownValid_ = false;
+  unsigned long lastStatsMs_ = 0;
+  
+  // Animation parameters in fixed point (set by show())
+  q16_t cycleQ_ = q16(3.0f);
+  q16_t cycleHzQ_ = q16(1.0f / 3.0f);
+  q16_t minQ_ = q16(0.1f);
+  q16_t maxQ_ = q16(0.5f);
+  q16_t patternHzQ_ = q16(0.5f);
+  float cycleDuration_ = 3.0f;
+  
+  void setBase(LedMoodId id, uint32_t color, int16_t fadeMs) {
+    LedLayer& base = stack_[0];
+    if (base.mood == id && base.color == color) return;
+    base = { id, color, 0 };
+    if (depth_ == 1) show(base, fadeMs);          // else revealed when the overlays end
+  }
+  
+  // Put layer on screen, crossfading from the last frame sent
+  void show(const LedLayer& layer, int16_t fadeMs) {
+    const LedMood& m = LED_MOODS[layer.mood];
+    Serial.printf("[LED] Mood: %s #%06lX\n", m.name, (unsigned long)layer.color);
+    animMode_ = m.anim;
+    pattern_ = m.pattern;
+    targetColor_ = layer.color;
+    secondColor_ = m.color2;
+    stateTimer_ = 0;
     
-    float brightness = calculateBrightness();
+    cycleDuration_ = m.cycle;
+    cycleQ_ = q16FromFloat(m.cycle);
+    cycleHzQ_ = q16FromFloat(1.0f / m.cycle);
+    minQ_ = q16FromFloat(m.minLevel);
+    maxQ_ = q16FromFloat(m.maxLevel);
+    patternHzQ_ = q16FromFloat(m.patternHz);
+    buildLevels();
     
-    // FLASH-ONCE FIX: Auto-restore previous mood after flash completes
-    if (animMode_ == ANIM_FLASH_ONCE && stateTimer_ > 0.5f && !flashRestored_) {
-        flashRestored_ = true;
-        // Restore previous mood after flash effect
-        if (strlen(previousMood_) > 0) {
-          Serial.printf("[LED] Flash complete, restoring to: %s\n", previousMood_);
-          // Don't call setMood directly to avoid recursion - just update internal state
-          char moodToRestore[16];
-          strncpy(moodToRestore, previousMood_, 15);
-          moodToRestore[15] = '\0';
-          previousMood_[0] = '\0'; // Clear to prevent loop
-          setMood(moodToRestore);
-          return;
-        }
+    const uint16_t ms = (fadeMs < 0) ? m.fadeMs : fadeMs;
+    if (ms == 0 || !shownValid_) {
+      fadeT_ = Q16_ONE;
+      return;
     }
+    memcpy(fadeFrom_, shown_, LedOutput::BYTES);
+    fadeRate_ = q16FromFloat(1000.0f / ms);
+    fadeT_ = 0;
+  }
+  
+  // Blend the new mood's frame over fadeFrom_, eased
+  void crossfade(uint8_t* px) const {
+    const int16_t k = q16Smoothstep(fadeT_) >> 8;   // 0..256
+    for (uint16_t i = 0; i < LedOutput::BYTES; i++) {
+      px[i] = fadeFrom_[i] + (((int16_t)px[i] - fadeFrom_[i]) * k >> 8);
+    }
+  }
+
+  uint8_t levelAt(uint32_t tq) const {
+    if (animMode_ == ANIM_FLASH_ONCE) return (tq < (uint32_t)cycleQ_) ? flashOn_ : flashOff_;
+    return levels_[(uint16_t)q16Cycles(tq, levelHzQ_) >> 8];
+  }
+  
+  static uint8_t toLevel(q16_t b) {
+    return (uint8_t)((min<q16_t>(max<q16_t>(b, 0), Q16_ONE) * 255 + Q16_HALF) >> 16);
+  }
+  
+  // Sample one period of the mood's curve. Gamma applies to the swing
+  // between the curve's own low and high, so the end points (and with them
+  // each mood's tuned min / max) stay put while the breath spends its time
+  // in the dim part the way the eye perceives it.
+  void buildLevels() {
+    float period = cycleDuration_;
+    if (animMode_ == ANIM_SHARP_PULSE) period *= 3;               // pulse, pulse, pause
+    if (animMode_ == ANIM_STEADY_GLOW) period = 2.0f * PI / 3.0f; // sin(3t)
+    levelHzQ_ = q16FromFloat(1.0f / period);
+    flashOn_ = toLevel(maxQ_);
+    flashOff_ = toLevel(minQ_);
     
-    uint32_t finalColor = strip_.Color(r * brightness, g * brightness, b * brightness);
+    q16_t samples[LEVEL_STEPS];
+    q16_t lo = Q16_ONE, hi = 0;
+    const uint32_t periodQ = q16Time(period);
+    for (uint16_t i = 0; i < LEVEL_STEPS; i++) {
+      samples[i] = calculateBrightness((uint32_t)(((uint64_t)periodQ * i) / LEVEL_STEPS));
+      if (samples[i] < lo) lo = samples[i];
+      if (samples[i] > hi) hi = samples[i];
+    }
+    const float span = q16ToFloat(hi - lo);
+    for (uint16_t i = 0; i < LEVEL_STEPS; i++) {
+      float u = (hi > lo) ? q16ToFloat(samples[i] - lo) / span : 0.0f;
+      levels_[i] = toLevel(lo + q16FromFloat(span * powf(u, LED_GAMMA)));
+    }
+  }
+  
+  // One frame of the current pattern into px (GRB). scale is the envelope
+  // level times global brightness, 0..65536; patterns weight it per pixel.
+  void drawPattern(uint8_t* px, uint32_t tq, uint32_t scale) {
+    const uint32_t turns = q16Cycles(tq, patternHzQ_);    // Q16 turns
+    uint16_t phase = (uint16_t)turns;                     // 0..65535 of a turn
+    if (pattern_ == PATTERN_SPINNER) phase = (uint16_t)min<q16_t>(q16Smoothstep(phase), 0xFFFF);
+    const uint16_t head = ((uint32_t)phase * NUM_LEDS) >> 8;   // 1/256 pixels
+    const uint32_t step = ((uint64_t)turns * NUM_LEDS) >> 16;  // whole pixels
     
-    // Apply to pixels
-    if (partialRing_) {
-      for (int i = 0; i < NUM_LEDS; i++) {
-        if (i % 3 == 0) strip_.setPixelColor(i, 0);
-        else strip_.setPixelColor(i, finalColor);
+    for (uint8_t i = 0; i < NUM_LEDS; i++) {
+      uint32_t color = targetColor_;
+      uint16_t w = 256;
+      switch (pattern_) {
+        case PATTERN_SOLID:
+          break;
+        case PATTERN_PARTIAL:
+          if (i % 3 == 0) w = 0;
+          break;
+        case PATTERN_COMET:
+          w = arcWeight(head, i, LED_COMET_TAIL);
+          break;
+        case PATTERN_CHASE:
+          w = ((i + LED_CHASE_GAP - step % LED_CHASE_GAP) % LED_CHASE_GAP == 0) ? 256 : 0;
+          break;
+        case PATTERN_GRADIENT: {
+          // Triangle over the ring, so both ends of the gradient meet smoothly
+          uint16_t u = (uint16_t)(((uint32_t)i << 16) / NUM_LEDS + phase);
+          uint16_t tri = (u < 0x8000) ? (u >> 7) : ((0xFFFF - u) >> 7);
+          color = mixColor(targetColor_, secondColor_, tri);
+          break;
+        }
+        case PATTERN_SPINNER:
+          w = max<uint16_t>(arcWeight(head, i, LED_SPINNER_ARC), LED_SPINNER_FLOOR);
+          break;
+        case PATTERN_SPECTRUM:
+          // Band level as brightness, towards secondColor_ at the top
+          w = voice_[i] + 1;
+          color = mixColor(targetColor_, secondColor_, w);
+          break;
       }
-    } else {
-      for (int i = 0; i < NUM_LEDS; i++) {
-        strip_.setPixelColor(i, finalColor);
+      setPixel(px, i, color, (scale * w) >> 8);
+    }
+  }
+  
+  // Weight of pixel i for an arc whose head sits at head (1/256 pixels) and
+  // whose tail fades out quadratically over tail pixels; the pixel ahead of
+  // the head is anti-aliased so the motion doesn't step
+  static uint16_t arcWeight(uint16_t head, uint8_t i, uint8_t tail) {
+    const uint16_t ring = NUM_LEDS * 256;
+    uint16_t behind = (head + ring - ((uint16_t)i << 8)) % ring;
+    if (behind < (uint16_t)tail * 256) {
+      uint16_t w = 256 - behind / tail;
+      return (w * w) >> 8;
+    }
+    uint16_t ahead = ring - behind;
+    return (ahead < 256) ? 256 - ahead : 0;
+  }
+  
+  static uint32_t mixColor(uint32_t a, uint32_t b, uint16_t t) {   // t 0..256
+    uint32_t o = 0;
+    for (uint8_t sh = 0; sh <= 16; sh += 8) {
+      int16_t ca = (a >> sh) & 0xFF, cb = (b >> sh) & 0xFF;
+      o |= (uint32_t)(uint8_t)(ca + (((cb - ca) * t) >> 8)) << sh;
+    }
+    return o;
+  }
+  
+  // color 0xRRGGBB at scale 0..65536
+  static void setPixel(uint8_t* px, uint8_t i, uint32_t color, uint32_t scale) {
+    px[i * 3]     = (((color >> 8) & 0xFF) * scale) >> 16;
+    px[i * 3 + 1] = (((color >> 16) & 0xFF) * scale) >> 16;
+    px[i * 3 + 2] = ((color & 0xFF) * scale) >> 16;
+  }
+  
+  // Scale the frame down to limitMa_ if it would draw more
+  void limitCurrent(uint8_t* px) {
+    static const uint16_t IDLE_MA = NUM_LEDS * POWER_LED_IDLE_MA;
+    uint32_t sum = 0;
+    for (uint16_t i = 0; i < LedOutput::BYTES; i++) sum += px[i];
+    uint32_t ma = IDLE_MA + sum * POWER_LED_MA_PER_CHANNEL / 255;
+    if (ma > limitMa_) {
+      const uint32_t room = (limitMa_ > IDLE_MA) ? limitMa_ - IDLE_MA : 0;
+      const uint32_t k = (room << 8) / (ma - IDLE_MA);    // 0..255
+      sum = 0;
+      for (uint16_t i = 0; i < LedOutput::BYTES; i++) {
+        px[i] = (px[i] * k) >> 8;
+        sum += px[i];
       }
+      ma = IDLE_MA + sum * POWER_LED_MA_PER_CHANNEL / 255;
+      stats_.limited++;
     }
-    
-    strip_.show();
+    currentMa_ = ma;
   }
 
-  void voiceReact(int level) {
-    // Throttle voice reaction too
-    static unsigned long lastVoiceUpdate = 0;
-    if (millis() - lastVoiceUpdate < 50) return;
-    lastVoiceUpdate = millis();
-
-    uint8_t brightness = map(level, 0, 100, 10, 200);
-    uint32_t color = strip_.Color(0, brightness, brightness / 2);
-    
-    for (int i = 0; i < NUM_LEDS; i++) {
-      strip_.setPixelColor(i, color);
+  // Commit only when the frame differs from the last one sent
+  void commitIfChanged(const uint8_t* px) {
+    if (shownValid_ && memcmp(px, shown_, LedOutput::BYTES) == 0) {
+      stats_.skipped++;
+      return;
     }
-    strip_.show();
+    memcpy(shown_, px, LedOutput::BYTES);
+    out_.commit();
+    shownValid_ = true;
+    stats_.shows++;
   }
 
-private:
-  Adafruit_NeoPixel strip_;
-  uint32_t targetColor_ = 0;
-  char currentMood_[16] = "idle";
-  char previousMood_[16] = ""; // For restoring after flash
-  bool flashRestored_ = false; // Prevent multiple restore calls
-  float stateTimer_ = 0.0f;
-  
-  // Animation parameters
-  float cycleDuration_ = 3.0f;
-  float minBrightness_ = 0.1f;
-  float maxBrightness_ = 0.5f;
-  bool partialRing_ = false;
-  
-  enum AnimMode {
-    ANIM_IDLE_BREATHE,
-    ANIM_GENTLE_PULSE,
-    ANIM_SLOW_BREATHE,
-    ANIM_DEEP_BREATHE,
-    ANIM_SHARP_PULSE,
-    ANIM_FLASH_ONCE,
-    ANIM_STEADY_GLOW
-  } animMode_ = ANIM_IDLE_BREATHE;
-
-  float calculateBrightness() {
-    float t = stateTimer_;
-    
+  // Brightness 0..1 (Q16) at animation time tq (wrapping Q16 seconds).
+  // Only sampled by buildLevels(), not per frame.
+  q16_t calculateBrightness(uint32_t tq) {
+
     switch (animMode_) {
       case ANIM_IDLE_BREATHE:
       case ANIM_GENTLE_PULSE: {
-        float wave = (sin(t * (2.0f * PI / cycleDuration_)) + 1.0f) * 0.5f;
-        return minBrightness_ + (wave * (maxBrightness_ - minBrightness_));
+        q16_t wave = q16Wave((uint16_t)q16Cycles(tq, cycleHzQ_));
+        return minQ_ + q16Mul(wave, maxQ_ - minQ_);
       }
       case ANIM_SLOW_BREATHE:
       case ANIM_DEEP_BREATHE: {
-        float wave = (sin(t * (2.0f * PI / cycleDuration_)) + 1.0f) * 0.5f;
-        wave = wave * wave * (3.0f - 2.0f * wave); // Cubic ease
-        return minBrightness_ + (wave * (maxBrightness_ - minBrightness_));
+        q16_t wave = q16Wave((uint16_t)q16Cycles(tq, cycleHzQ_));
+        wave = q16Smoothstep(wave); // Cubic ease
+        return minQ_ + q16Mul(wave, maxQ_ - minQ_);
       }
       case ANIM_SHARP_PULSE: {
-        int pulseNum = (int)(t / cycleDuration_) % 3;
-        float pulseTime = fmod(t, cycleDuration_) / cycleDuration_;
-        if (pulseNum < 2) return (pulseTime < 0.3f) ? maxBrightness_ : minBrightness_;
-        return minBrightness_;
+        uint32_t cycles = q16Cycles(tq, cycleHzQ_);
+        int pulseNum = (cycles >> 16) % 3;
+        uint16_t pulseTime = (uint16_t)cycles;
+        if (pulseNum < 2) return (pulseTime < (uint16_t)q16(0.3f)) ? maxQ_ : minQ_;
+        return minQ_;
       }
       case ANIM_FLASH_ONCE: {
-        if (t < cycleDuration_) return maxBrightness_;
-        return minBrightness_;
+        if (tq < (uint32_t)cycleQ_) return maxQ_;
+        return minQ_;
       }
       case ANIM_STEADY_GLOW: {
-        float wave = (sin(t * 3.0f) + 1.0f) * 0.5f;
-        return minBrightness_ + (wave * 0.1f); // Tiny breathing
+        // sin(3t): 3 rad/s
+        q16_t wave = q16Wave((uint16_t)q16Cycles(tq, q16(3.0f / (2.0f * PI))));
+        return minQ_ + q16Mul(wave, q16(0.1f)); // Tiny breathing
       }
-      default: return minBrightness_;
+      default: return minQ_;
     }
   }
+
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,157 @@
+#ifndef LED_MOODS_H
+#define LED_MOODS_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// LED MOODS - What the ring does for each mood, as data
+// ============================================================================
+// One row per LedMoodId, in id order (checked at compile time), so a mood
+// change is an index. A mood is a colour, a brightness envelope (LedAnim over
+// cycle seconds between min and max), a per-pixel pattern and the crossfade
+// used when it takes over the ring. Rows with an overlay time are transient:
+// LedController shows them on top of the current mood and restores it when
+// the time is up (the surprise flash, the voice spectrum).
+//
+// Names are only for the websocket boundary (findLedMood); behaviors and the
+// rest of the firmware pass ids.
+
+enum LedMoodId : uint8_t {
+  MOOD_IDLE,
+  MOOD_HAPPY,
+  MOOD_SURPRISED,
+  MOOD_SAD,
+  MOOD_SLEEPY,
+  MOOD_ANGRY,
+  MOOD_LISTENING,
+  MOOD_ORANGE,
+  MOOD_THINKING,
+  MOOD_SPEAKING,
+  MOOD_PLAYFUL,
+  MOOD_CURIOUS,
+  MOOD_VOICE,         // mic spectrum bars, refreshed by voiceReact()
+  MOOD_CUSTOM,        // any colour from the web UI
+  MOOD_OFF,
+  MOOD_COUNT
+};
+
+enum LedAnim : uint8_t {
+  ANIM_IDLE_BREATHE,
+  ANIM_GENTLE_PULSE,
+  ANIM_SLOW_BREATHE,
+  ANIM_DEEP_BREATHE,
+  ANIM_SHARP_PULSE,
+  ANIM_FLASH_ONCE,
+  ANIM_STEADY_GLOW
+};
+
+enum LedPattern : uint8_t {
+  PATTERN_SOLID,
+  PATTERN_PARTIAL,     // every third pixel dark
+  PATTERN_COMET,       // bright head, fading tail, turning
+  PATTERN_CHASE,       // every LED_CHASE_GAP-th pixel lit, stepping
+  PATTERN_GRADIENT,    // color -> color2 -> back, turning
+  PATTERN_SPINNER,     // short arc with eased turns over a dim ring
+  PATTERN_SPECTRUM     // one mic band per pixel
+};
+
+constexpr uint32_t ledRgb(uint8_t r, uint8_t g, uint8_t b) {
+  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+struct LedMood {
+  LedMoodId id;
+  const char* name;
+  uint32_t color;       // 0xRRGGBB (MOOD_CUSTOM: replaced by the requested colour)
+  uint32_t color2;      // PATTERN_GRADIENT far end
+  LedAnim anim;
+  float cycle;          // envelope period, s
+  float minLevel;       // envelope range, 0..1
+  float maxLevel;
+  LedPattern pattern;
+  float patternHz;      // pattern turns per second
+  uint16_t fadeMs;      // crossfade into this mood
+  uint16_t overlayMs;   // 0 = mood; else shown on top for this long, then restored
+};
+
+static constexpr LedMood LED_MOODS[] = {
+  // id              name         color                 color2               anim               cycle  min    max    pattern           Hz     fade  overlay
+  { MOOD_IDLE,      "idle",      ledRgb(80, 180, 220), 0,                   ANIM_IDLE_BREATHE, 3.0f, 0.15f, 0.45f, PATTERN_SOLID,    0.5f,  600,  0   },
+  { MOOD_HAPPY,     "happy",     ledRgb(255, 200, 50), 0,                   ANIM_GENTLE_PULSE, 3.5f, 0.3f,  0.7f,  PATTERN_SOLID,    0.5f,  300,  0   },
+  { MOOD_SURPRISED, "surprised", ledRgb(255, 255, 255), 0,                  ANIM_FLASH_ONCE,   0.2f, 0.1f,  0.5f,  PATTERN_SOLID,    0.5f,  0,    500 },
+  { MOOD_SAD,       "sad",       ledRgb(40, 60, 180),  0,                   ANIM_SLOW_BREATHE, 6.0f, 0.05f, 0.25f, PATTERN_SOLID,    0.5f,  1200, 0   },
+  { MOOD_SLEEPY,    "sleeping",  ledRgb(80, 60, 140),  0,                   ANIM_DEEP_BREATHE, 7.0f, 0.02f, 0.15f, PATTERN_PARTIAL,  0.5f,  1500, 0   },
+  { MOOD_ANGRY,     "angry",     ledRgb(255, 40, 0),   0,                   ANIM_SHARP_PULSE,  0.8f, 0.2f,  1.0f,  PATTERN_SOLID,    0.5f,  150,  0   },
+  { MOOD_LISTENING, "listening", ledRgb(0, 255, 100),  0,                   ANIM_STEADY_GLOW,  3.0f, 0.5f,  0.6f,  PATTERN_SOLID,    0.5f,  250,  0   },
+  { MOOD_ORANGE,    "orange",    ledRgb(255, 140, 0),  0,                   ANIM_GENTLE_PULSE, 3.0f, 0.3f,  0.6f,  PATTERN_SOLID,    0.5f,  400,  0   },
+  { MOOD_THINKING,  "thinking",  ledRgb(120, 80, 255), 0,                   ANIM_STEADY_GLOW,  3.0f, 0.4f,  0.5f,  PATTERN_SPINNER,  0.8f,  400,  0   },
+  { MOOD_SPEAKING,  "speaking",  ledRgb(80, 180, 220), 0,                   ANIM_STEADY_GLOW,  3.0f, 0.4f,  0.5f,  PATTERN_COMET,    0.6f,  300,  0   },
+  { MOOD_PLAYFUL,   "playful",   ledRgb(255, 120, 40), 0,                   ANIM_GENTLE_PULSE, 2.0f, 0.4f,  0.7f,  PATTERN_CHASE,    0.5f,  300,  0   },
+  { MOOD_CURIOUS,   "curious",   ledRgb(80, 180, 220), ledRgb(140, 60, 200), ANIM_IDLE_BREATHE, 3.0f, 0.3f,  0.5f,  PATTERN_GRADIENT, 0.25f, 500,  0   },
+  { MOOD_VOICE,     "voice",     ledRgb(0, 200, 100),  ledRgb(255, 60, 160), ANIM_STEADY_GLOW,  3.0f, 1.0f,  1.0f,  PATTERN_SPECTRUM, 0.5f,  80,   LED_VOICE_HOLD_MS },
+  { MOOD_CUSTOM,    "custom",    ledRgb(80, 180, 220), 0,                   ANIM_IDLE_BREATHE, 3.0f, 0.3f,  0.6f,  PATTERN_SOLID,    0.5f,  400,  0   },
+  { MOOD_OFF,       "off",       0,                    0,                   ANIM_STEADY_GLOW,  3.0f, 0.0f,  0.0f,  PATTERN_SOLID,    0.5f,  500,  0   },
+};
+
+static_assert(sizeof(LED_MOODS) / sizeof(LED_MOODS[0]) == MOOD_COUNT, "LED_MOODS[] needs one row per LedMoodId");
+
+constexpr bool ledMoodIdsInOrder(int i) {
+  return i == MOOD_COUNT || (LED_MOODS[i].id == i && ledMoodIdsInOrder(i + 1));
+}
+static_assert(ledMoodIdsInOrder(0), "LED_MOODS[] rows must be in LedMoodId order");
+
+// Names the server and older firmware used for the same moods
+struct LedMoodAlias {
+  const char* name;
+  LedMoodId id;
+};
+
+static const LedMoodAlias LED_MOOD_ALIASES[] = {
+  { "calm_idle",   MOOD_IDLE },
+  { "cyan",        MOOD_IDLE },
+  { "shy_happy",   MOOD_HAPPY },
+  { "startled",    MOOD_SURPRISED },
+  { "blue",        MOOD_SAD },
+  { "sleepy_idle", MOOD_SLEEPY },
+  { "purple",      MOOD_SLEEPY },
+  { "red",         MOOD_ANGRY },
+  { "green",       MOOD_LISTENING },
+};
+
+// Websocket boundary only; false for unknown names
+inline bool findLedMood(const char* name, LedMoodId& id) {
+  for (uint8_t i = 0; i < MOOD_COUNT; i++) {
+    if (strcmp(LED_MOODS[i].name, name) == 0) {
+      id = (LedMoodId)i;
+      return true;
+    }
+  }
+  for (const LedMoodAlias& a : LED_MOOD_ALIASES) {
+    if (strcmp(a.name, name) == 0) {
+      id = a.id;
+      return true;
+    }
+  }
+  return false;
+}
+
+// "#rrggbb" or "rrggbb" (either case) to 0xRRGGBB
+inline bool parseHexColor(const char* s, uint32_t& rgb) {
+  if (*s == '#') s++;
+  uint32_t v = 0;
+  for (uint8_t i = 0; i < 6; i++) {
+    char c = s[i];
+    uint8_t d;
+    if (c >= '0' && c <= '9') d = c - '0';
+    else if (c >= 'a' && c <= 'f') d = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') d = c - 'A' + 10;
+    else return false;
+    v = (v << 4) | d;
+  }
+  if (s[6] != '\0') return false;
+  rgb = v;
+  return true;
+}
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef LED_OUTPUT_H
+#define LED_OUTPUT_H
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "driver/rmt.h"
+#include "config.h"
+#include "pins.h"
+
+// ============================================================================
+// LED OUTPUT - Double-buffered WS2812 transport (LED_RMT_TASK)
+// ============================================================================
+// Two GRB pixel buffers. The animation draws into pixels(); commit() hands
+// that buffer to a transport task which clocks it out on an RMT channel and
+// waits for the end of transmission there, while the caller carries on
+// drawing into the other buffer. The main loop never waits on the ring: a
+// frame drawn while both buffers are still queued is refused (ready() is
+// false) and the next frame replaces it, the same back-pressure as OledBus.
+//
+// Without the task (LED_RMT_TASK false, or the RMT driver didn't install)
+// commit() copies the buffer into an Adafruit_NeoPixel strip and show()s it
+// synchronously, as the ring always did.
+
+struct LedOutputStats {
+  uint32_t frames = 0;          // buffers sent to the ring
+  uint32_t refused = 0;         // frames skipped because both buffers were busy
+  uint32_t busyUs = 0;          // total time inside rmt_write_sample()
+  uint32_t errors = 0;
+};
+
+class LedOutput {
+public:
+  static const uint16_t BYTES = NUM_LEDS * 3;
+
+  LedOutput() {
+    busy_[0].store(false);
+    busy_[1].store(false);
+  }
+
+  void begin() {
+#if LED_RMT_TASK
+    if (initRmt() && startTask()) return;
+#endif
+    strip_.begin();                           // full brightness: buffers arrive pre-scaled
+    strip_.show();
+  }
+
+  // Buffer to draw the next frame into, GRB byte order
+  uint8_t* pixels() { return buf_[fill_]; }
+
+  // A frame can be drawn now (always true while synchronous)
+  bool ready() const { return !task_ || !busy_[fill_].load(std::memory_order_acquire); }
+
+  // Send what was drawn into pixels()
+  void commit() {
+    if (!task_) {
+      memcpy(strip_.getPixels(), buf_[fill_], BYTES);
+      uint32_t start = micros();
+      strip_.show();
+      stats_.busyUs += micros() - start;
+      stats_.frames++;
+      return;
+    }
+    uint8_t idx = fill_;
+    busy_[idx].store(true, std::memory_order_release);
+    xQueueSend(queue_, &idx, portMAX_DELAY);
+    fill_ ^= 1;
+  }
+
+  // Frame skipped for back-pressure
+  void noteRefused() { stats_.refused++; }
+
+  bool async() const { return task_ != nullptr; }
+  const LedOutputStats& stats() const { return stats_; }
+
+private:
+  static const uint8_t STAGES = 2;
+
+  // WS2812 bit timings in 25 ns RMT ticks (clk_div 2 of the 80 MHz APB)
+  static const uint8_t RMT_CLK_DIV = 2;
+  static const uint16_t T0H = 14, T0L = 34;   // 0.35 / 0.85 us
+  static const uint16_t T1H = 28, T1L = 24;   // 0.70 / 0.60 us
+  static const uint16_t LATCH_US = 300;       // WS2812B reset low time
+
+  uint8_t buf_[STAGES][BYTES] = {};
+  uint8_t fill_ = 0;                          // buffer the animation draws into
+  std::atomic<bool> busy_[STAGES];            // queued or on the wire
+
+  Adafruit_NeoPixel strip_{NUM_LEDS, PIN_NEOPIXEL, NEO_GRB + NEO_KHZ800};
+  QueueHandle_t queue_ = nullptr;
+  TaskHandle_t task_ = nullptr;
+  LedOutputStats stats_;
+
+  bool initRmt() {
+    rmt_config_t conf = RMT_DEFAULT_CONFIG_TX((gpio_num_t)PIN_NEOPIXEL, (rmt_channel_t)LED_RMT_CHANNEL);
+    conf.clk_div = RMT_CLK_DIV;
+    if (rmt_config(&conf) != ESP_OK ||
+        rmt_driver_install(conf.channel, 0, 0) != ESP_OK ||
+        rmt_translator_init(conf.channel, translate) != ESP_OK) {
+      Serial.println("[LED] RMT driver install failed - using blocking show()");
+      return false;
+    }
+    return true;
+  }
+
+  bool startTask() {
+    queue_ = xQueueCreate(STAGES, sizeof(uint8_t));
+    if (!queue_) return false;
+    BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "led_out", LED_TASK_STACK, this,
+                                            LED_TASK_PRIORITY, &task_, LED_TASK_CORE);
+    if (ok != pdPASS) {
+      task_ = nullptr;
+      Serial.println("[LED] Output task creation failed - using blocking show()");
+      return false;
+    }
+    Serial.printf("[LED] RMT output on channel %d, %d pixels\n", LED_RMT_CHANNEL, NUM_LEDS);
+    return true;
+  }
+
+  // Transport side
+  static void taskEntry(void* arg) {
+    static_cast<LedOutput*>(arg)->run();
+  }
+
+  void run() {
+    uint8_t idx;
+    for (;;) {
+      if (xQueueReceive(queue_, &idx, portMAX_DELAY) != pdTRUE) continue;
+      uint32_t start = micros();
+      if (rmt_write_sample((rmt_channel_t)LED_RMT_CHANNEL, buf_[idx], BYTES, true) != ESP_OK) {
+        stats_.errors++;
+      }
+      stats_.busyUs += micros() - start;
+      stats_.frames++;
+      delayMicroseconds(LATCH_US);            // this task's time, not the loop's
+      busy_[idx].store(false, std::memory_order_release);
+    }
+  }
+
+  // RMT translator: one item per bit, MSB first. Runs from the RMT ISR.
+  static void IRAM_ATTR translate(const void* src, rmt_item32_t* dest, size_t srcSize,
+                                  size_t wanted, size_t* translated, size_t* items) {
+    if (!src || !dest) {
+      *translated = 0;
+      *items = 0;
+      return;
+    }
+    rmt_item32_t bit0, bit1;
+    bit0.duration0 = T0H; bit0.level0 = 1; bit0.duration1 = T0L; bit0.level1 = 0;
+    bit1.duration0 = T1H; bit1.level0 = 1; bit1.duration1 = T1L; bit1.level1 = 0;
+
+    const uint8_t* p = static_cast<const uint8_t*>(src);
+    size_t size = 0, num = 0;
+    while (size < srcSize && num + 8 <= wanted) {
+      for (uint8_t b = 0; b < 8; b++) {
+        dest[num++].val = (p[size] & (0x80 >> b)) ? bit1.val : bit0.val;
+      }
+      size++;
+    }
+    *translated = size;
+    *items = num;
+  }
+};
+
+#endif
@@ -14,13 +14,18 @@
 #include "sensors.h"
 #include "led_controller.h"
 #include "servo_controller.h"
+#include "timelines.h"
 #include "websocket_client.h"
 #include "audio_manager.h"
 #include "mic_manager.h"
+#include "audio_spectrum.h"
 #include "wifi_manager.h"
 #include "rtc_manager.h"
-#include "soc/soc.h"
-#include "soc/rtc_cntl_reg.h"
+#include "anim_clock.h"
+#include "render_task.h"
+#include "frame_governor.h"
+#include "power_budget.h"
+#include "perf_bench.h"
 #include "esp_task_wdt.h"
 
 
@@ -30,7 +35,15 @@ void processWebSocketMessage(const WsQueueMessage& msg);
 void handleMessage(const char* type, JsonDocument& doc);
 
 // --- OBJECTS ---
+#if OLED_ASYNC_I2C && OLED_PAGE_BUFFER
+U8G2_SH1106_128X64_NONAME_1_ASYNC_I2C display(U8G2_R0);
+#elif OLED_ASYNC_I2C
+U8G2_SH1106_128X64_NONAME_F_ASYNC_I2C display(U8G2_R0);
+#elif OLED_PAGE_BUFFER
+U8G2_SH1106_128X64_NONAME_1_HW_I2C display(U8G2_R0, U8X8_PIN_NONE, PIN_I2C_SCL, PIN_I2C_SDA);
+#else
 U8G2_SH1106_128X64_NONAME_F_HW_I2C display(U8G2_R0, U8X8_PIN_NONE, PIN_I2C_SCL, PIN_I2C_SDA);
+#endif
 EyeEngine eye(display);
 SensorManager sensors;
 LedController leds;
@@ -40,77 +53,17 @@ AudioManager audioMgr;
 MicManager micMgr;
 WiFiManager wifiMgr;
 RTCManager rtcMgr;
-
-// --- SOUND MANAGER ---
-class SoundManager {
-public:
-  void update() {
-    if (!active) return;
-    
-    unsigned long now = millis();
-    if (now - lastUpdate >= noteDuration) {
-      if (noteIndex < sequenceLength) {
-        int freq = sequence[noteIndex * 2];
-        noteDuration = sequence[noteIndex * 2 + 1];
-        
-        if (freq > 0) tone(PIN_BUZZER, freq);
-        else noTone(PIN_BUZZER);
-        
-        lastUpdate = now;
-        noteIndex++;
-      } else {
-        noTone(PIN_BUZZER);
-        active = false;
-      }
-    }
-  }
-
-  void play(const char* name) {
-    if (active) return;
-    
-    noteIndex = 0;
-    active = true;
-    lastUpdate = millis();
-
-    if (strcmp(name, "startup") == 0) {
-      setNote(0, 880, 100); setNote(1, 1046, 100); setNote(2, 1318, 200);
-      sequenceLength = 3;
-    } 
-    else if (strcmp(name, "happy") == 0) {
-      setNote(0, 1568, 80); setNote(1, 0, 50); setNote(2, 2093, 100);
-      sequenceLength = 3;
-    }
-    else if (strcmp(name, "sad") == 0) {
-      setNote(0, 440, 200); setNote(1, 392, 300); setNote(2, 349, 400);
-      sequenceLength = 3;
-    }
-    else if (strcmp(name, "surprised") == 0) {
-      setNote(0, 2000, 50); setNote(1, 2500, 50);
-      sequenceLength = 2;
-    }
-    else if (strcmp(name, "curious") == 0) {
-      setNote(0, 523, 100); setNote(1, 659, 100); setNote(2, 784, 150);
-      sequenceLength = 3;
-    }
-    else if (strcmp(name, "sleep") == 0) {
-      setNote(0, 300, 300); setNote(1, 200, 400);
-      sequenceLength = 2;
-    }
-  }
-
-private:
-  bool active = false;
-  unsigned long lastUpdate = 0;
-  int sequence[20];
-  int sequenceLength = 0;
-  int noteIndex = 0;
-  int noteDuration = 0;
-
-  void setNote(int idx, int freq, int dur) {
-    sequence[idx * 2] = freq;
-    sequence[idx * 2 + 1] = dur;
-  }
-} soundFx;
+AnimClock animClock;
+RenderTask renderTask;
+TimelinePlayer timeline;
+FrameGovernor governor;
+PowerBudget power;
+#if OLED_MIRROR && !OLED_PAGE_BUFFER
+OledMirror oledMirror;
+#endif
+#if ENABLE_MICROPHONE
+AudioSpectrum spectrum;
+#endif
 
 // --- STATE VARIABLES ---
 const Behavior* activeBehavior = nullptr;
@@ -168,50 +121,8 @@ void startBehavior(const char* name, unsigned long now) {
   activeBehavior = b;
   behaviorStartTime = now; // CRITICAL: Use the synchronized 'now' time
   
-  // 1. SET EYE TARGET
-  eye.setTarget(b);
-  
-  // 2. SET LED MOOD
-  if (b->ledEffect) leds.setMood(b->ledEffect);
-  else leds.setMood(name);
-  
-  // 3. SERVO & SOUND ACTIONS (synced to behavior durations for natural movement)
-  // Calculate total behavior duration for auto-return
-  unsigned long behaviorDuration = b->entryTime + b->holdTime + b->exitTime;
-  if (behaviorDuration == 0) behaviorDuration = 5000; // Default for infinite behaviors
-  
-  if (strcmp(name, "happy") == 0 || strcmp(name, "shy_happy") == 0) {
-    servo.triggerGesture("shake", behaviorDuration); // Shake converted from nod for cardboard
-    soundFx.play("happy");
-  } 
-  else if (strcmp(name, "sad") == 0) {
-    servo.setTarget(70, behaviorDuration); // Droop left (cardboard safe: 60-120)
-    soundFx.play("sad");
-  }
-  else if (strcmp(name, "surprised") == 0 || strcmp(name, "startled") == 0) {
-    servo.setTarget(75, behaviorDuration); // Quick jolt left
-    soundFx.play("surprised");
-  }
-  else if (strcmp(name, "curious_idle") == 0) {
-    servo.triggerGesture("tilt", behaviorDuration);
-    soundFx.play("curious");
-  }
-  else if (strcmp(name, "sleepy_idle") == 0) {
-    servo.setTarget(100, behaviorDuration); // Slight tilt
-    soundFx.play("sleep");
-  }
-  else if (strcmp(name, "listening") == 0 || strcmp(name, "calm_idle") == 0) {
-    servo.returnToCenter(); // Always center for these
-  }
-  else if (strcmp(name, "confused") == 0) {
-    servo.setTarget(105, behaviorDuration); // Tilt right
-  }
-  else if (strcmp(name, "thinking") == 0) {
-    servo.setTarget(95, behaviorDuration); // Slight tilt
-  }
-  else if (strcmp(name, "playful_mischief") == 0) {
-    servo.triggerGesture("shake", behaviorDuration);
-  }
+  // Eyes, LED mood, head and sound all come from the behavior's timeline
+  timeline.play(timeline.forBehavior(b->id, builtInTimeline(b->id)));
 
   if (robotWs.isConnected()) {
     robotWs.sendStatus("sync_behavior", name);
@@ -223,6 +134,13 @@ void startBehavior(const char* name) {
     startBehavior(name, millis());
 }
 
+// LED command from the web UI: "#rrggbb" (any colour) or a mood name
+void ledCommand(const char* cmd) {
+  Serial.printf("[LED] Web command: %s\n", cmd);
+  timeline.stop(TRACK_LED);
+  if (!leds.command(cmd)) Serial.printf("[LED] Unknown LED command: %s\n", cmd);
+}
+
 // Track if behavior was triggered from web UI (don't override with sensors)
 bool webBehaviorActive = false;
 unsigned long webBehaviorTime = 0;
@@ -236,27 +154,18 @@ void processWebSocketMessage(const WsQueueMessage& msg) {
       startBehavior(msg.data, millis());
       break;
     case WS_MSG_SERVO_ACTION:
+      timeline.stop(TRACK_SERVO);
       servo.setTarget(msg.intValue, 3000);
       lastInteractionTime = millis();
       break;
     case WS_MSG_LED_ACTION:
-      Serial.printf("[LED] Web command: %s\n", msg.data);
-      if (strcmp(msg.data, "off") == 0) {
-        leds.setMood("sleeping");
-      } 
-      else if (strcmp(msg.data, "#ff0000") == 0) leds.setMood("red");
-      else if (strcmp(msg.data, "#00ff00") == 0) leds.setMood("green");
-      else if (strcmp(msg.data, "#0000ff") == 0) leds.setMood("blue");
-      else if (strcmp(msg.data, "#ffff00") == 0) leds.setMood("happy");
-      else if (strcmp(msg.data, "#ff00ff") == 0) leds.setMood("purple");
-      else if (strcmp(msg.data, "#00ffff") == 0) leds.setMood("cyan");
-      else if (strcmp(msg.data, "#ffffff") == 0) leds.setMood("surprised");
-      else leds.setMood(msg.data);
+      ledCommand(msg.data);
       lastInteractionTime = millis();
       break;
     case WS_MSG_PLAY_AUDIO:
       startBehavior("listening");
       audioMgr.playURL(msg.data);
+      if (SUBTITLE_ENABLED && msg.text[0] && audioMgr.getIsPlaying()) eye.showSubtitle(msg.text);
       lastInteractionTime = millis();
       break;
     case WS_MSG_REQUEST_STATE:
@@ -273,6 +182,45 @@ void processWebSocketMessage(const WsQueueMessage& msg) {
     case WS_MSG_STOPWATCH_RESET:
       rtcMgr.stopwatchReset();
       break;
+    case WS_MSG_OLED_MIRROR:
+#if OLED_MIRROR && !OLED_PAGE_BUFFER
+      Serial.printf("[MIRROR] %s\n", msg.intValue ? "Streaming to dashboard" : "Stopped");
+      oledMirror.setEnabled(msg.intValue);
+#endif
+      break;
+    case WS_MSG_GESTURE: {
+      GestureId g;
+      if (findGesture(msg.data, g)) {
+        timeline.stop(TRACK_SERVO);
+        servo.playGesture(g);
+      } else if (strcmp(msg.data, "uploaded") == 0) {
+        timeline.stop(TRACK_SERVO);
+        servo.playGesture(GESTURE_UPLOADED);
+      } else {
+        Serial.printf("[SERVO] Unknown gesture: %s\n", msg.data);
+      }
+      lastInteractionTime = millis();
+      break;
+    }
+    case WS_MSG_BINARY: {
+      const uint8_t* data = robotWs.binary();
+      if (data[0] == TIMELINE_MAGIC) {
+        // Uploaded choreography: previewed now, and used for its behavior
+        // from then on (until reboot)
+        const uint8_t* blob = timeline.load(data, robotWs.binaryLen());
+        if (blob) timeline.play(blob);
+      } else if (data[0] == GESTURE_MAGIC) {
+        // Uploaded gesture: played now, then by name "uploaded"
+        if (servo.loadGesture(data, robotWs.binaryLen())) {
+          timeline.stop(TRACK_SERVO);
+          servo.playGesture(GESTURE_UPLOADED);
+        }
+      } else {
+        Serial.printf("[WS] Unknown binary upload '%c'\n", data[0]);
+      }
+      robotWs.binaryDone();
+      break;
+    }
     default:
       break;
   }
@@ -286,27 +234,14 @@ void handleMessage(const char* type, JsonDocument& doc) {
     startBehavior(doc["name"], millis()); // FIXED: Use millis() instead of wrapper
   }
   else if (strcmp(type, "servo_action") == 0) {
+    timeline.stop(TRACK_SERVO);
     servo.setTarget(doc["angle"], 3000); // Auto-return after 3s
     lastInteractionTime = millis();
   }
   else if (strcmp(type, "led_action") == 0) {
     // Handle LED color commands from web UI - supports hex colors
     const char* color = doc["color"];
-    if (color) {
-      Serial.printf("[LED] Web command: %s\n", color);
-      
-      if (strcmp(color, "off") == 0) {
-        leds.setMood("sleeping");
-      } 
-      else if (strcmp(color, "#ff0000") == 0) leds.setMood("red");
-      else if (strcmp(color, "#00ff00") == 0) leds.setMood("green");
-      else if (strcmp(color, "#0000ff") == 0) leds.setMood("blue");
-      else if (strcmp(color, "#ffff00") == 0) leds.setMood("happy");
-      else if (strcmp(color, "#ff00ff") == 0) leds.setMood("purple");
-      else if (strcmp(color, "#00ffff") == 0) leds.setMood("cyan");
-      else if (strcmp(color, "#ffffff") == 0) leds.setMood("surprised");
-      else leds.setMood(color);
-    }
+    if (color) ledCommand(color);
     lastInteractionTime = millis();
   }
   else if (strcmp(type, "play_audio") == 0) {
@@ -407,9 +342,15 @@ void testAudioSystems() {
   startBehavior("calm_idle");
 }
 
+// --- QUALITY GOVERNOR ---
+void applyQuality(const QualityProfile& q) {
+  eye.setParticleLimit(q.maxParticles);
+  eye.setSaccadesEnabled(q.saccades);
+  animClock.setRenderRate(q.renderFps);
+}
+
 // --- SETUP ---
 void setup() {
-  WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 0);
   Serial.begin(115200);
   delay(500);
   
@@ -417,13 +358,21 @@ void setup() {
   Serial.println("  DESKBOT COMPANION - FINAL FIX");
   Serial.println("========================================\n");
 
+  #if !OLED_ASYNC_I2C
   Wire.begin(PIN_I2C_SDA, PIN_I2C_SCL);
-  display.begin();
+  #endif
+  display.begin(); // Async transport: sends synchronously until startTask()
   leds.begin();
   servo.begin();
   sensors.begin();
   rtcMgr.begin();
-  soundFx.play("startup");
+  micMgr.begin();
+  #if ENABLE_MICROPHONE
+  spectrum.begin();
+  #endif
+  timeline.attach(&eye, &leds, &servo);
+  checkTimelines();
+  timeline.play(TL_STARTUP);
 
   Serial.println("[INIT] WiFi...");
   wifiMgr.begin();
@@ -435,7 +384,23 @@ void setup() {
       robotWs.begin();
   }
   
+  animClock.begin(ANIM_TICK_HZ, RENDER_FPS, ANIM_MAX_CATCHUP_TICKS);
+  eye.setTickInterval(animClock.tickDt());
+  
+  #if ENABLE_PERF_BENCH
+  PerfBench::runAll(eye, animClock.tickDt());
+  #endif
+  
   eye.startBootSequence();
+  #if OLED_ASYNC_I2C
+  if (OledBus::instance().startTask()) eye.attachBus(&OledBus::instance());
+  #endif
+  #if OLED_MIRROR && !OLED_PAGE_BUFFER
+  eye.attachMirror(&oledMirror);        // streams only once the server enables it
+  #endif
+  renderTask.begin(eye); // Owns the display from here on
+  governor.begin(GOVERNOR_LOOP_BUDGET_US);
+  power.begin(POWER_BUDGET_MA);
   startBehavior("calm_idle");
   lastInteractionTime = millis();
   lastIdleCheckTime = millis();
@@ -445,11 +410,8 @@ void setup() {
 }
 
 void loop() {
-  static unsigned long lastTime = 0;
   static unsigned long lastWiFiCheck = 0;
   unsigned long now = millis();
-  float dt = (now - lastTime) / 1000.0f;
-  lastTime = now;
 
   // RESTART FIX: Periodic WiFi health check to prevent silent disconnection
   if (now - lastWiFiCheck > 30000) { // Every 30 seconds
@@ -462,23 +424,72 @@ void loop() {
 
   // 1. Critical Loops
   if (WiFi.status() == WL_CONNECTED) {
+    uint32_t t = micros();
     robotWs.loop();
+    governor.add(SECTION_WS, t);
+    
+    t = micros();
     audioMgr.update();
+    governor.add(SECTION_AUDIO, t);
     
     // Process WebSocket messages from queue
+    t = micros();
     WsQueueMessage wsMsg;
     while (robotWs.getMessage(wsMsg)) {
       processWebSocketMessage(wsMsg);
     }
+    
+#if OLED_MIRROR && !OLED_PAGE_BUFFER
+    // Dashboard mirror: send what the render side encoded; push one more
+    // frame through when the last one was over the stream budget
+    if (oledMirror.enabled() && !robotWs.isConnected()) oledMirror.setEnabled(false);
+    if (oledMirror.packetReady()) {
+      robotWs.sendBinary(oledMirror.packet(), oledMirror.packetLen());
+      oledMirror.packetSent();
+    }
+    if (oledMirror.wantsFrame()) eye.forceFrame();
+#endif
+    governor.add(SECTION_WS, t);
   } else {
     wifiMgr.handlePortal();
   }
 
-  // 2. Component Updates
-  eye.update(dt);
-  leds.loop(dt);
-  servo.loop(dt);
-  soundFx.update();
+  // 2. Component Updates (fixed timestep, independent of loop speed)
+  uint8_t ticks = animClock.advance(micros());
+  const float tickDt = animClock.tickDt();
+  for (uint8_t i = 0; i < ticks; i++) {
+    timeline.tick(animClock.tickUs());
+    eye.tick(tickDt);
+    uint32_t t = micros();
+    leds.tick(tickDt);
+    governor.add(SECTION_LEDS, t);
+  }
+  servo.update();
+  power.update(leds, servo, audioMgr.getIsPlaying());
+  if (uint8_t marker = servo.takeSync()) {
+    // Gesture sync points, for dashboards that animate along with the head
+    char detail[4];
+    snprintf(detail, sizeof(detail), "%u", marker);
+    if (robotWs.isConnected()) robotWs.sendStatus("gesture_sync", detail);
+  }
+  
+  // Mic blocks arrive every 16 ms; the ring and the eyes follow the spectrum
+  #if ENABLE_MICROPHONE
+  {
+    uint32_t t = micros();
+    if (micMgr.update() && spectrum.process(micMgr.block())) {
+      if (micMgr.getLoudness() > 20) leds.voiceReact(spectrum.peaks()); // Higher threshold for LED react
+      eye.setVoiceLevel(spectrum.average(0, 4));                         // ~125-300 Hz, voice fundamentals
+    }
+    governor.add(SECTION_AUDIO, t);
+  }
+  #endif
+  
+  // Subtitle scrolls with the MP3 and goes away with it
+  if (eye.subtitleShowing()) {
+    if (audioMgr.getIsPlaying()) eye.setSubtitleProgress(audioMgr.getProgressPermille());
+    else eye.hideSubtitle();
+  }
   
   // SLEEP FIX: Skip ultrasonic during sleep to prevent micro-freezes
   bool inSleepState = inSleepMode || inDarkSleepMode;
@@ -493,11 +504,30 @@ void loop() {
     eye.hideStopwatch();
   }
   
-  eye.render(); // Render after all updates
+  // Render after all updates, at RENDER_FPS, interpolated between ticks.
+  // The OLED frame is only published here (and only if it would look
+  // different); the render task draws and sends it.
+  if (animClock.renderDue(micros())) {
+    const float alpha = animClock.alpha();
+    uint32_t t = micros();
+    if (renderTask.running()) {
+      EyeFrame frame = eye.snapshot(alpha);
+      if (eye.frameChanged(frame)) renderTask.publish(frame);
+    } else {
+      eye.render(alpha);
+    }
+    governor.add(SECTION_RENDER, t);
+    
+    t = micros();
+    leds.render(alpha);
+    governor.add(SECTION_LEDS, t);
+  }
   
   // FREEZE FIX: Call audio update again after render to keep playback smooth
   if (WiFi.status() == WL_CONNECTED && audioMgr.getIsPlaying()) {
+    uint32_t t = micros();
     audioMgr.update();
+    governor.add(SECTION_AUDIO, t);
   }
 
   // 3. Sensor Logic (Crowd-Proof)
@@ -625,7 +655,6 @@ void loop() {
         activityDetected = true;
         lastVolumeTrigger = now;
       }
-      if (vol > 20) leds.voiceReact(vol); // Higher threshold for LED react
     }
     #endif
 
@@ -717,5 +746,23 @@ void loop() {
     delay(10); // Small delay to let background tasks (WiFi, WS heartbeat) run
   }
   
+  // 5. Frame budget: degrade eye quality under load, report the level
+  if (governor.endLoop()) applyQuality(governor.profile());
+  static unsigned long lastQualitySend = 0;
+  if (robotWs.isConnected() && now - lastQualitySend > GOVERNOR_TELEMETRY_MS) {
+    #if ENABLE_MICROPHONE
+    robotWs.sendQuality(governor, &spectrum.stats());
+    #else
+    robotWs.sendQuality(governor);
+    #endif
+    lastQualitySend = now;
+  }
+  static unsigned long lastPowerSend = 0;
+  if (robotWs.isConnected() && now - lastPowerSend > POWER_TELEMETRY_MS) {
+    robotWs.sendPower(power);
+    power.resetPeak();
+    lastPowerSend = now;
+  }
+  
   yield();
 }
\ No newline at end of file
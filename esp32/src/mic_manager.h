@@ -7,12 +7,16 @@
 #include "config.h"
 
 #define I2S_MIC_PORT I2S_NUM_1
-#define SAMPLE_RATE 16000
-#define BUFFER_LEN 32  // Reduced for memory efficiency
+#define BUFFER_LEN 64  // DMA buffers hold one SPECTRUM_N block between two reads
 
+// Samples are collected without blocking into SPECTRUM_N blocks; update()
+// says when one is complete, for AudioSpectrum and the loudness value.
 class MicManager {
 private:
   bool initialized = false;  // Start as false, set to true only after successful init
+  int16_t block_[SPECTRUM_N];
+  uint16_t fill_ = 0;
+  int loudness_ = 0;
 
 public:
   void begin() {
@@ -24,12 +28,12 @@ public:
 
     i2s_config_t i2s_config = {
       .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX),
-      .sample_rate = SAMPLE_RATE,
+      .sample_rate = MIC_SAMPLE_RATE,
       .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
       .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
       .communication_format = I2S_COMM_FORMAT_STAND_I2S,
       .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-      .dma_buf_count = 2,  // Reduced from 4
+      .dma_buf_count = SPECTRUM_N / BUFFER_LEN,
       .dma_buf_len = BUFFER_LEN,
       .use_apll = false,
       .tx_desc_auto_clear = false,
@@ -60,28 +64,39 @@ public:
     Serial.println("[MIC] Initialized successfully");
   }
 
-  int getLoudness() {
-    if (!initialized) return 0;
+  // Pull whatever the DMA has (never waits). True when a full block is
+  // ready in block(); it stays valid until the next update() call.
+  bool update() {
+    if (!initialized) return false;
+    if (fill_ == SPECTRUM_N) fill_ = 0;
 
     int32_t samples[BUFFER_LEN];
-    size_t bytes_read = 0;
-    
-    esp_err_t err = i2s_read(I2S_MIC_PORT, samples, sizeof(samples), &bytes_read, 10);
-    if (err != ESP_OK || bytes_read == 0) return 0;
+    while (fill_ < SPECTRUM_N) {
+      size_t bytes_read = 0;
+      size_t want = min<size_t>(sizeof(samples), (SPECTRUM_N - fill_) * sizeof(int32_t));
+      esp_err_t err = i2s_read(I2S_MIC_PORT, samples, want, &bytes_read, 0);
+      if (err != ESP_OK || bytes_read == 0) return false;
+      for (size_t i = 0; i < bytes_read / sizeof(int32_t); i++) {
+        block_[fill_++] = samples[i] >> 16;  // 24-bit left aligned -> 16-bit
+      }
+    }
 
     uint64_t sum = 0;
-    int sample_count = bytes_read / sizeof(int32_t);
-    
-    for (int i = 0; i < sample_count; i++) {
-      int32_t sample = samples[i] >> 14;  // Normalize 24-bit to 16-bit
-      sum += (uint64_t)(sample * sample);
+    for (uint16_t i = 0; i < SPECTRUM_N; i++) {
+      int32_t sample = (int32_t)block_[i] << 2;  // Same scale as the old >> 14
+      sum += (uint64_t)((int64_t)sample * sample);  // |sample| reaches 2^17: square in 64 bits
     }
-    
-    float rms = sqrt((double)sum / sample_count);
-    int vol = (int)(rms / 50.0); 
-    return (vol > 100) ? 100 : vol;
+    float rms = sqrt((double)sum / SPECTRUM_N);
+    int vol = (int)(rms / 50.0);
+    loudness_ = (vol > 100) ? 100 : vol;
+    return true;
   }
 
+  const int16_t* block() const { return block_; }
+
+  // 0..100, from the last complete block
+  int getLoudness() const { return loudness_; }
+
   bool isReady() { return initialized; }
 };
 
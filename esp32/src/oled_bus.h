@@ -0,0 +1,282 @@
+#ifndef OLED_BUS_H
+#define OLED_BUS_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "driver/i2c.h"
+#include "config.h"
+#include "pins.h"
+
+// ============================================================================
+// OLED BUS - Non-blocking I2C transport for the SH1106 (OLED_ASYNC_I2C)
+// ============================================================================
+// A U8g2 byte callback that does not talk to the bus itself. Every I2C
+// transaction U8g2 produces (START_TRANSFER .. END_TRANSFER) is appended to a
+// staging buffer; commit() hands the buffer to a transport task that replays
+// it as ESP-IDF command links. Two staging buffers: the renderer fills one
+// while the other is on the wire, so renderFrame() returns as soon as its
+// frame is queued instead of after ~25 ms of 400 kHz I2C.
+//
+// Back-pressure: with one frame on the wire and one queued, ready() is false
+// and the caller skips the frame without touching the TileFlusher shadow -
+// its changes are merged into the next frame that does get through.
+//
+// Before startTask() (display.begin(), boot screens) transactions are sent
+// synchronously from the caller, exactly like the Wire callback did.
+
+struct OledBusStats {
+  uint32_t frames = 0;          // staging buffers sent
+  uint32_t refused = 0;         // frames skipped because both buffers were busy
+  uint32_t transactions = 0;
+  uint32_t bytes = 0;           // bytes on the wire, address byte included
+  uint32_t busyUs = 0;          // total time inside i2c_master_cmd_begin()
+  uint32_t errors = 0;          // NACK / timeout, panel content unknown afterwards
+  uint32_t overflows = 0;       // transactions that didn't fit in a staging buffer
+};
+
+class OledBus {
+public:
+  // One panel, one bus: the U8g2 byte callback needs a fixed instance
+  static OledBus& instance() {
+    static OledBus bus;
+    return bus;
+  }
+
+  // u8x8 byte callback (pass to u8g2_Setup_*)
+  static uint8_t byteCb(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr) {
+    OledBus& bus = instance();
+    switch (msg) {
+      case U8X8_MSG_BYTE_INIT:
+        bus.initDriver();
+        break;
+      case U8X8_MSG_BYTE_SET_DC:
+        break;                                   // I2C: D/C is the control byte
+      case U8X8_MSG_BYTE_START_TRANSFER:
+        bus.startTransaction(u8x8_GetI2CAddress(u8x8));
+        break;
+      case U8X8_MSG_BYTE_SEND:
+        bus.append((const uint8_t*)argPtr, argInt);
+        break;
+      case U8X8_MSG_BYTE_END_TRANSFER:
+        bus.endTransaction();
+        break;
+      default:
+        return 0;
+    }
+    return 1;
+  }
+
+  // Switch to asynchronous mode. waiter (optional) is notified whenever a
+  // staging buffer frees up, so a refused frame can be retried right away.
+  bool startTask(TaskHandle_t waiter = nullptr) {
+    waiter_ = waiter;
+    if (task_) return true;
+    queue_ = xQueueCreate(STAGES, sizeof(uint8_t));
+    if (!queue_) return false;
+    BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "oled_bus", OLED_BUS_TASK_STACK, this,
+                                            OLED_BUS_TASK_PRIORITY, &task_, OLED_BUS_TASK_CORE);
+    if (ok != pdPASS) {
+      task_ = nullptr;
+      Serial.println("[I2C] Transport task creation failed - staying synchronous");
+      return false;
+    }
+    Serial.printf("[I2C] Async OLED transport on port %d, %lu Hz\n", OLED_I2C_PORT, (unsigned long)OLED_I2C_HZ);
+    return true;
+  }
+
+  void setWaiter(TaskHandle_t waiter) { waiter_ = waiter; }
+
+  // A frame can be staged now (always true while synchronous)
+  bool ready() const { return !task_ || !busy_[fill_].load(std::memory_order_acquire); }
+
+  // Queue everything staged since the last commit
+  void commit() {
+    if (!task_ || stage_[fill_].len == 0) return;
+    uint8_t idx = fill_;
+    busy_[idx].store(true, std::memory_order_release);
+    xQueueSend(queue_, &idx, portMAX_DELAY);
+    fill_ ^= 1;
+  }
+
+  // Frame skipped for back-pressure (counted here so all bus numbers are in one place)
+  void noteRefused() { stats_.refused++; }
+
+  // True once after a transfer error or overflow: the panel may not show what
+  // the flusher's shadow thinks it does, so the next frame must be sent whole
+  bool takeResync() { return resync_.exchange(false); }
+
+  bool async() const { return task_ != nullptr; }
+  const OledBusStats& stats() const { return stats_; }
+
+  // Bus busy percentage since the previous call
+  uint8_t utilizationPct() {
+    uint32_t now = micros();
+    uint32_t busy = stats_.busyUs - lastBusyUs_;
+    uint32_t window = now - lastWindowUs_;
+    lastBusyUs_ = stats_.busyUs;
+    lastWindowUs_ = now;
+    return window ? (uint8_t)min<uint32_t>(100, (uint64_t)busy * 100 / window) : 0;
+  }
+
+private:
+  static const uint8_t STAGES = 2;
+
+  // Transactions stored back to back as [len lo][len hi][bytes...]
+  struct Stage {
+    uint8_t data[OLED_BUS_STAGE_BYTES];
+    uint16_t len = 0;
+    uint8_t addr = 0x78;              // 8-bit U8g2 address, write bit clear
+  };
+
+  Stage stage_[STAGES];
+  uint8_t fill_ = 0;                  // stage the renderer writes into
+  std::atomic<bool> busy_[STAGES];    // queued or on the wire
+  std::atomic<bool> resync_{false};
+  uint16_t txStart_ = 0;              // offset of the open transaction's length
+  bool txOpen_ = false;
+  bool driverReady_ = false;
+
+  QueueHandle_t queue_ = nullptr;
+  TaskHandle_t task_ = nullptr;
+  TaskHandle_t waiter_ = nullptr;
+  uint8_t link_[I2C_LINK_RECOMMENDED_SIZE(1)];
+
+  OledBusStats stats_;
+  uint32_t lastBusyUs_ = 0;
+  uint32_t lastWindowUs_ = 0;
+
+  OledBus() {
+    busy_[0].store(false);
+    busy_[1].store(false);
+  }
+
+  void initDriver() {
+    if (driverReady_) return;
+    i2c_config_t conf = {};
+    conf.mode = I2C_MODE_MASTER;
+    conf.sda_io_num = PIN_I2C_SDA;
+    conf.scl_io_num = PIN_I2C_SCL;
+    conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
+    conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
+    conf.master.clk_speed = OLED_I2C_HZ;
+    if (i2c_param_config((i2c_port_t)OLED_I2C_PORT, &conf) != ESP_OK ||
+        i2c_driver_install((i2c_port_t)OLED_I2C_PORT, I2C_MODE_MASTER, 0, 0, 0) != ESP_OK) {
+      Serial.println("[I2C] Driver install failed");
+      return;
+    }
+    driverReady_ = true;
+  }
+
+  // Renderer side. Drawing outside renderFrame() (no ready() check) just
+  // waits for the stage to come back rather than corrupting a queued frame.
+  void startTransaction(uint8_t addr) {
+    while (task_ && busy_[fill_].load(std::memory_order_acquire)) vTaskDelay(1);
+    Stage& s = stage_[fill_];
+    if (s.len == 0) s.addr = addr;
+    txOpen_ = s.len + 2 <= OLED_BUS_STAGE_BYTES;
+    if (!txOpen_) {
+      stats_.overflows++;
+      resync_ = true;
+      return;
+    }
+    txStart_ = s.len;
+    s.len += 2;
+  }
+
+  void append(const uint8_t* data, uint8_t n) {
+    if (!txOpen_) return;
+    Stage& s = stage_[fill_];
+    if (s.len + n > OLED_BUS_STAGE_BYTES) {
+      // Drop the whole transaction, a partial one would confuse the panel
+      s.len = txStart_;
+      txOpen_ = false;
+      stats_.overflows++;
+      resync_ = true;
+      return;
+    }
+    memcpy(s.data + s.len, data, n);
+    s.len += n;
+  }
+
+  void endTransaction() {
+    if (!txOpen_) return;
+    txOpen_ = false;
+    Stage& s = stage_[fill_];
+    uint16_t n = s.len - txStart_ - 2;
+    s.data[txStart_] = n & 0xFF;
+    s.data[txStart_ + 1] = n >> 8;
+
+    if (!task_) {
+      transmit(s);                    // synchronous mode
+      s.len = 0;
+    }
+  }
+
+  // Transport side
+  static void taskEntry(void* arg) {
+    static_cast<OledBus*>(arg)->run();
+  }
+
+  void run() {
+    uint8_t idx;
+    for (;;) {
+      if (xQueueReceive(queue_, &idx, portMAX_DELAY) != pdTRUE) continue;
+      transmit(stage_[idx]);
+      stage_[idx].len = 0;
+      stats_.frames++;
+      busy_[idx].store(false, std::memory_order_release);
+      if (waiter_) xTaskNotifyGive(waiter_);
+    }
+  }
+
+  void transmit(const Stage& s) {
+    if (!driverReady_) return;
+    uint16_t pos = 0;
+    while (pos + 2 <= s.len) {
+      uint16_t n = s.data[pos] | (s.data[pos + 1] << 8);
+      const uint8_t* payload = s.data + pos + 2;
+      pos += 2 + n;
+
+      i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link_, sizeof(link_));
+      i2c_master_start(cmd);
+      i2c_master_write_byte(cmd, s.addr | I2C_MASTER_WRITE, true);
+      if (n) i2c_master_write(cmd, payload, n, true);
+      i2c_master_stop(cmd);
+
+      uint32_t start = micros();
+      esp_err_t err = i2c_master_cmd_begin((i2c_port_t)OLED_I2C_PORT, cmd, pdMS_TO_TICKS(50));
+      stats_.busyUs += micros() - start;
+      i2c_cmd_link_delete_static(cmd);
+
+      stats_.transactions++;
+      stats_.bytes += n + 1;
+      if (err != ESP_OK) {
+        stats_.errors++;
+        resync_ = true;
+      }
+    }
+  }
+};
+
+// SH1106 full-buffer display on the async transport (same panel setup as
+// U8G2_SH1106_128X64_NONAME_F_HW_I2C, pins and clock come from config/pins.h)
+class U8G2_SH1106_128X64_NONAME_F_ASYNC_I2C : public U8G2 {
+public:
+  explicit U8G2_SH1106_128X64_NONAME_F_ASYNC_I2C(const u8g2_cb_t* rotation) : U8G2() {
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, rotation, OledBus::byteCb, u8x8_gpio_and_delay_arduino);
+  }
+};
+
+// Page-buffer variant (OLED_PAGE_BUFFER): one 128-byte page in RAM
+class U8G2_SH1106_128X64_NONAME_1_ASYNC_I2C : public U8G2 {
+public:
+  explicit U8G2_SH1106_128X64_NONAME_1_ASYNC_I2C(const u8g2_cb_t* rotation) : U8G2() {
+    u8g2_Setup_sh1106_i2c_128x64_noname_1(&u8g2, rotation, OledBus::byteCb, u8x8_gpio_and_delay_arduino);
+  }
+};
+
+#endif
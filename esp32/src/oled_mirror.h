@@ -0,0 +1,210 @@
+#ifndef OLED_MIRROR_H
+#define OLED_MIRROR_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+
+// ============================================================================
+// OLED MIRROR - The real framebuffer, streamed to the dashboard
+// ============================================================================
+// After the render side has drawn a frame, capture() encodes it against the
+// last frame it streamed and leaves one binary packet for the main loop to
+// send over the robot websocket (WebSocketsClient is not thread safe, so the
+// render task never sends itself). Packet layout, little endian:
+//
+//   [0]    'O'
+//   [1]    flags         bit 0 = keyframe
+//   [2..3] sequence
+//   [4..5] payload length
+//   [6..]  payload: the 1 KB page buffer (keyframe) or its XOR against the
+//          previous packet's frame (delta), RLE packed like anim clips:
+//          0x00..0x7F = n+1 literal bytes, 0x80..0xFF = next byte x (n-0x7E)
+//
+// The stream is capped at OLED_MIRROR_FPS packets and OLED_MIRROR_MAX_BPS
+// bytes per second (token bucket), so it stays far below the MP3 stream on
+// the same WiFi link. A frame that doesn't fit the budget is skipped without
+// touching the shadow - its change goes out merged into a later delta - and
+// wantsFrame() asks the main loop to push one more frame once the budget is
+// back, so the dashboard never stays on a stale picture.
+
+struct MirrorStats {
+  uint32_t packets = 0;
+  uint32_t keyframes = 0;
+  uint32_t bytes = 0;            // packet bytes, headers included
+  uint32_t skipped = 0;          // frames over the rate / byte budget
+  uint32_t busy = 0;             // frames dropped while a packet was unsent
+};
+
+class OledMirror {
+public:
+  static const uint16_t FRAME_BYTES = 1024;
+  static const uint8_t HEADER_BYTES = 6;
+  static const uint8_t MAGIC = 'O';
+  static const uint8_t FLAG_KEYFRAME = 0x01;
+
+  // Main loop side -----------------------------------------------------------
+
+  // Dashboard watching or not; every enable starts with a keyframe
+  void setEnabled(bool enabled) {
+    if (enabled) keyRequested_.store(true, std::memory_order_relaxed);
+    enabled_.store(enabled, std::memory_order_release);
+  }
+
+  bool enabled() const { return enabled_.load(std::memory_order_acquire); }
+
+  // A packet is waiting for sendBIN(); call packetSent() afterwards
+  bool packetReady() const { return ready_.load(std::memory_order_acquire); }
+  const uint8_t* packet() const { return packet_; }
+  uint16_t packetLen() const { return packetLen_; }
+  void packetSent() { ready_.store(false, std::memory_order_release); }
+
+  // The last captured frame was skipped and the budget allows a packet again
+  bool wantsFrame() const {
+    return behind_.load(std::memory_order_acquire) && !packetReady() &&
+           (uint32_t)(millis() - lastPacketMs_) >= 1000 / OLED_MIRROR_FPS;
+  }
+
+  const MirrorStats& stats() const { return stats_; }
+
+  // Render side --------------------------------------------------------------
+
+  // buf: the complete U8g2 full buffer, as just sent to the panel
+  void capture(const uint8_t* buf) {
+    if (!enabled()) return;
+    if (packetReady()) {
+      stats_.busy++;
+      behind_.store(true, std::memory_order_release);
+      return;
+    }
+
+    const uint32_t now = millis();
+    refill(now);
+    if ((uint32_t)(now - lastPacketMs_) < 1000 / OLED_MIRROR_FPS) {
+      stats_.skipped++;
+      behind_.store(true, std::memory_order_release);
+      return;
+    }
+
+    bool key = keyRequested_.exchange(false, std::memory_order_relaxed) ||
+               sinceKey_ >= OLED_MIRROR_KEYFRAME_EVERY;
+    uint16_t len = 0;
+    if (!key) {
+      len = encode(buf, shadow_, packet_ + HEADER_BYTES);
+      if (len == 0) {                           // identical to what was streamed
+        behind_.store(false, std::memory_order_release);
+        return;
+      }
+    }
+    // Keyframe when due, or when it packs smaller than the delta (sized
+    // first without writing, the delta is already in the packet)
+    if (!key && len > KEY_CHECK_BYTES && encode(buf, nullptr, nullptr) < len) key = true;
+    if (key) len = encode(buf, nullptr, packet_ + HEADER_BYTES);
+
+    const uint16_t total = HEADER_BYTES + len;
+    if (total > tokens_) {
+      if (key) keyRequested_.store(true, std::memory_order_relaxed);
+      stats_.skipped++;
+      behind_.store(true, std::memory_order_release);
+      return;
+    }
+    tokens_ -= total;
+
+    packet_[0] = MAGIC;
+    packet_[1] = key ? FLAG_KEYFRAME : 0;
+    packet_[2] = seq_ & 0xFF;
+    packet_[3] = seq_ >> 8;
+    packet_[4] = len & 0xFF;
+    packet_[5] = len >> 8;
+    packetLen_ = total;
+    seq_++;
+    sinceKey_ = key ? 1 : sinceKey_ + 1;
+    memcpy(shadow_, buf, FRAME_BYTES);
+    lastPacketMs_ = now;
+
+    stats_.packets++;
+    stats_.bytes += total;
+    if (key) stats_.keyframes++;
+    behind_.store(false, std::memory_order_release);
+    ready_.store(true, std::memory_order_release);
+  }
+
+private:
+  // Worst case for this PackBits variant is "x y y" repeated: 4 bytes per 3
+  static const uint16_t PAYLOAD_MAX = FRAME_BYTES + FRAME_BYTES / 3 + 2;
+  static const uint16_t KEY_CHECK_BYTES = 256;   // bigger deltas try a keyframe too
+
+  uint8_t shadow_[FRAME_BYTES] = {};             // frame the dashboard has
+  uint8_t packet_[HEADER_BYTES + PAYLOAD_MAX];
+  uint16_t packetLen_ = 0;
+  uint16_t seq_ = 0;
+  uint16_t sinceKey_ = 0;
+  uint32_t tokens_ = OLED_MIRROR_MAX_BPS;        // bytes
+  uint32_t lastRefillMs_ = 0;
+  uint32_t lastPacketMs_ = 0;
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<bool> ready_{false};
+  std::atomic<bool> behind_{false};
+  std::atomic<bool> keyRequested_{true};
+  MirrorStats stats_;
+
+  void refill(uint32_t now) {
+    uint32_t add = (uint64_t)(now - lastRefillMs_) * OLED_MIRROR_MAX_BPS / 1000;
+    if (add == 0) return;
+    lastRefillMs_ = now;
+    tokens_ = min<uint32_t>(OLED_MIRROR_MAX_BPS, tokens_ + add);
+  }
+
+  // PackBits-style RLE of cur (or cur ^ prev) into out (nullptr: just
+  // measure); returns 0 for an all-zero delta. Same run / literal choices
+  // as tools/png2clip.py.
+  static uint16_t encode(const uint8_t* cur, const uint8_t* prev, uint8_t* out) {
+    uint16_t o = 0, i = 0, lit = 0, litStart = 0;
+    bool any = prev == nullptr;
+    while (i < FRAME_BYTES) {
+      const uint8_t v = prev ? cur[i] ^ prev[i] : cur[i];
+      if (v) any = true;
+      uint16_t run = 1;
+      while (i + run < FRAME_BYTES && run < 129 &&
+             (prev ? (uint8_t)(cur[i + run] ^ prev[i + run]) : cur[i + run]) == v) {
+        run++;
+      }
+      if (run >= 2) {
+        o = flushLiteral(cur, prev, litStart, lit, out, o);
+        lit = 0;
+        if (out) {
+          out[o] = 0x7E + run;
+          out[o + 1] = v;
+        }
+        o += 2;
+        i += run;
+      } else {
+        if (lit == 0) litStart = i;
+        lit++;
+        i++;
+      }
+    }
+    o = flushLiteral(cur, prev, litStart, lit, out, o);
+    return any ? o : 0;
+  }
+
+  static uint16_t flushLiteral(const uint8_t* cur, const uint8_t* prev, uint16_t start,
+                               uint16_t n, uint8_t* out, uint16_t o) {
+    while (n) {
+      uint8_t chunk = n > 128 ? 128 : n;
+      if (out) {
+        out[o] = chunk - 1;
+        for (uint8_t k = 0; k < chunk; k++) {
+          out[o + 1 + k] = prev ? cur[start + k] ^ prev[start + k] : cur[start + k];
+        }
+      }
+      o += 1 + chunk;
+      start += chunk;
+      n -= chunk;
+    }
+    return o;
+  }
+};
+
+#endif
@@ -0,0 +1,275 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "fixed_math.h"
+
+// ============================================================================
+// PARTICLE SYSTEM - Pooled sprites for eye effects (hearts, Zzz, sparkles...)
+// ============================================================================
+// Effects are data: each one is a handful of emitters (where to spawn, how
+// often, velocity, lifetime, sprite). Emitters feed one static pool stored as
+// structure-of-arrays, so ticking touches only the arrays it needs and
+// nothing is allocated at runtime. Several effects can run at once; the pool
+// and emitter table are fixed size, so per-frame cost is bounded by
+// MAX_PARTICLES whatever is live. When the pool is full new spawns are
+// dropped, never old particles.
+//
+// Simulation runs on the animation tick; snapshot() flattens the live
+// particles into a ParticleFrame (screen position, sprite, current size) that
+// travels inside EyeFrame to the render task.
+
+enum ParticleKind : uint8_t {
+  PK_GLYPH,       // one character, 6x10 font
+  PK_GLYPH_BIG,   // one character, 9x15 font
+  PK_HEART,       // 8x9 box heart
+  PK_SPARKLE,     // cross, radius swells 0 -> size -> 0 over its life
+  PK_DOT,         // disc, radius swells 1 -> size -> 1 over its life
+  PK_BEAM         // XOR horizontal line, half-width = size
+};
+
+struct EmitterDef {
+  ParticleKind kind;
+  int8_t x, y;            // spawn point, relative to the effect anchor
+  int8_t stepX, stepY;    // added per spawn, cycling over `slots` positions
+  uint8_t slots;          // 1 = always the same spawn point
+  int16_t vx, vy;         // px/s
+  uint16_t lifeMs;
+  uint16_t intervalMs;    // 0 = spawn once when the effect starts
+  uint16_t delayMs;       // first spawn after the effect starts
+  uint8_t size;
+  const char* glyphs;     // PK_GLYPH*: character per slot (cycled)
+};
+
+struct ParticleSprite {
+  int16_t x, y;           // screen px
+  ParticleKind kind;
+  uint8_t size;           // current size (after life shaping)
+  char glyph;
+};
+
+struct ParticleFrame {
+  static const uint8_t MAX = 24;
+  uint8_t count = 0;
+  ParticleSprite sprites[MAX];
+};
+
+struct ParticleStats {
+  uint32_t spawned = 0;
+  uint32_t dropped = 0;   // spawns refused because the pool was full (or at its limit)
+  uint8_t live = 0;
+  uint8_t peak = 0;
+};
+
+class ParticleSystem {
+public:
+  static const uint8_t MAX_PARTICLES = ParticleFrame::MAX;
+  static const uint8_t MAX_EMITTERS = 8;
+
+  // Start a set of emitters under a tag (the effect id). Re-starting a tag
+  // restarts its emitters from scratch.
+  void start(uint8_t tag, const EmitterDef* defs, uint8_t count, int anchorX, int anchorY) {
+    stop(tag);
+    for (uint8_t d = 0; d < count; d++) {
+      for (uint8_t e = 0; e < MAX_EMITTERS; e++) {
+        Emitter& em = emitters_[e];
+        if (em.def) continue;
+        em.def = &defs[d];
+        em.tag = tag;
+        em.slot = 0;
+        em.anchorX = anchorX;
+        em.anchorY = anchorY;
+        em.timer = q16(defs[d].delayMs / 1000.0f);
+        break;
+      }
+    }
+  }
+
+  // Stop spawning for a tag; its live particles play out their lifetime
+  void stop(uint8_t tag) {
+    for (uint8_t e = 0; e < MAX_EMITTERS; e++) {
+      if (emitters_[e].def && emitters_[e].tag == tag) emitters_[e].def = nullptr;
+    }
+  }
+
+  // Pool limit for new spawns (frame governor); live particles play out
+  void setLimit(uint8_t limit) { limit_ = limit < MAX_PARTICLES ? limit : MAX_PARTICLES; }
+
+  void clear() {
+    for (uint8_t e = 0; e < MAX_EMITTERS; e++) emitters_[e].def = nullptr;
+    count_ = 0;
+    stats_.live = 0;
+  }
+
+  // dt in Q16 seconds
+  void tick(q16_t dt) {
+    // Age and move; expired particles are swap-removed so the live set
+    // always stays packed at the front of the arrays
+    for (uint8_t i = 0; i < count_; ) {
+      age_[i] += dt;
+      if (age_[i] >= life_[i]) {
+        removeAt(i);
+        continue;
+      }
+      x_[i] += vx_[i] * dt;
+      y_[i] += vy_[i] * dt;
+      i++;
+    }
+
+    for (uint8_t e = 0; e < MAX_EMITTERS; e++) {
+      Emitter& em = emitters_[e];
+      if (!em.def) continue;
+      em.timer -= dt;
+      if (em.timer > 0) continue;
+      spawn(em);
+      if (em.def->intervalMs == 0) {
+        em.def = nullptr;                                   // one-shot burst
+      } else {
+        em.timer += q16(em.def->intervalMs / 1000.0f);
+        if (em.timer <= 0) em.timer = q16(em.def->intervalMs / 1000.0f); // no spawn bursts after a stall
+      }
+    }
+    stats_.live = count_;
+  }
+
+  void snapshot(ParticleFrame& out) const {
+    out.count = count_;
+    for (uint8_t i = 0; i < count_; i++) {
+      ParticleSprite& s = out.sprites[i];
+      s.x = (int16_t)(x_[i] >> 16);
+      s.y = (int16_t)(y_[i] >> 16);
+      s.kind = (ParticleKind)kind_[i];
+      s.glyph = glyph_[i];
+      s.size = size_[i];
+      if (kind_[i] == PK_SPARKLE || kind_[i] == PK_DOT) {
+        // Half a sine wave over the lifetime
+        uint16_t phase = (uint16_t)(((int64_t)age_[i] * 0x8000) / life_[i]);
+        s.size = (uint8_t)((q16Sin(phase) * size_[i] + Q16_HALF) >> 16);
+        if (kind_[i] == PK_DOT && s.size == 0) s.size = 1;
+      }
+    }
+  }
+
+  const ParticleStats& stats() const { return stats_; }
+
+private:
+  struct Emitter {
+    const EmitterDef* def = nullptr;   // nullptr = free slot
+    uint8_t tag = 0;
+    uint8_t slot = 0;
+    int16_t anchorX = 0;
+    int16_t anchorY = 0;
+    q16_t timer = 0;                   // time until next spawn
+  };
+
+  // Structure-of-arrays pool, [0, count_) are live
+  q16_t x_[MAX_PARTICLES];
+  q16_t y_[MAX_PARTICLES];
+  int16_t vx_[MAX_PARTICLES];
+  int16_t vy_[MAX_PARTICLES];
+  q16_t age_[MAX_PARTICLES];
+  q16_t life_[MAX_PARTICLES];
+  uint8_t kind_[MAX_PARTICLES];
+  uint8_t size_[MAX_PARTICLES];
+  char glyph_[MAX_PARTICLES];
+  uint8_t count_ = 0;
+  uint8_t limit_ = MAX_PARTICLES;
+
+  Emitter emitters_[MAX_EMITTERS];
+  ParticleStats stats_;
+
+  void spawn(Emitter& em) {
+    const EmitterDef& d = *em.def;
+    uint8_t slot = em.slot;
+    em.slot = (d.slots > 1) ? (uint8_t)((slot + 1) % d.slots) : 0;
+
+    if (count_ >= limit_) {
+      stats_.dropped++;
+      return;
+    }
+    uint8_t i = count_++;
+    x_[i] = q16FromInt(em.anchorX + d.x + d.stepX * slot);
+    y_[i] = q16FromInt(em.anchorY + d.y + d.stepY * slot);
+    vx_[i] = d.vx;
+    vy_[i] = d.vy;
+    age_[i] = 0;
+    life_[i] = q16(d.lifeMs / 1000.0f);
+    if (life_[i] <= 0) life_[i] = 1;
+    kind_[i] = d.kind;
+    size_[i] = d.size;
+    glyph_[i] = d.glyphs ? d.glyphs[slot % strlen(d.glyphs)] : 0;
+
+    stats_.spawned++;
+    if (count_ > stats_.peak) stats_.peak = count_;
+  }
+
+  void removeAt(uint8_t i) {
+    uint8_t last = --count_;
+    if (i == last) return;
+    x_[i] = x_[last];
+    y_[i] = y_[last];
+    vx_[i] = vx_[last];
+    vy_[i] = vy_[last];
+    age_[i] = age_[last];
+    life_[i] = life_[last];
+    kind_[i] = kind_[last];
+    size_[i] = size_[last];
+    glyph_[i] = glyph_[last];
+  }
+};
+
+// Rasterize a particle snapshot (render side)
+inline void drawParticles(U8G2& display, const ParticleFrame& pf) {
+  char str[2] = {0, 0};
+  for (uint8_t i = 0; i < pf.count; i++) {
+    const ParticleSprite& s = pf.sprites[i];
+    display.setDrawColor(1);
+    switch (s.kind) {
+      case PK_GLYPH:
+      case PK_GLYPH_BIG:
+        if (s.y > -5 && s.y < 64 && s.x >= 0 && s.x < 125) {
+          display.setFont(s.kind == PK_GLYPH ? u8g2_font_6x10_tr : u8g2_font_9x15_tr);
+          str[0] = s.glyph;
+          display.drawStr(s.x, s.y, str);
+        }
+        break;
+
+      case PK_HEART:
+        if (s.y > 0 && s.y < 55 && s.x > 0 && s.x < 120) {
+          display.drawBox(s.x, s.y, 2, 2);
+          display.drawBox(s.x + 4, s.y, 2, 2);
+          display.drawBox(s.x - 1, s.y + 2, 8, 3);
+          display.drawBox(s.x + 1, s.y + 5, 4, 2);
+          display.drawBox(s.x + 2, s.y + 7, 2, 2);
+        }
+        break;
+
+      case PK_SPARKLE:
+        if (s.size > 0) {
+          display.drawLine(s.x - s.size, s.y, s.x + s.size, s.y); // Horizontal Line
+          display.drawLine(s.x, s.y - s.size, s.x, s.y + s.size); // Vertical Line
+        }
+        break;
+
+      case PK_DOT:
+        if (s.x >= s.size && s.x < 128 - s.size && s.y >= s.size && s.y < 64 - s.size) {
+          display.drawDisc(s.x, s.y, s.size);
+        }
+        break;
+
+      case PK_BEAM:
+        if (s.y >= 0 && s.y < 64) {
+          // XOR so the beam stays visible across the white eye
+          int x0 = constrain(s.x - s.size, 0, 127);
+          int x1 = constrain(s.x + s.size, 0, 127);
+          display.setDrawColor(2);
+          display.drawHLine(x0, s.y, x1 - x0 + 1);
+        }
+        break;
+    }
+  }
+  display.setDrawColor(1);
+}
+
+#endif
@@ -0,0 +1,330 @@
+#ifndef PERF_BENCH_H
+#define PERF_BENCH_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "behaviors.h"
+#include "eye_engine.h"
+#include "fixed_math.h"
+#include "frame_check.h"
+#include "audio_spectrum.h"
+
+// ============================================================================
+// PERF BENCH - Boot-time micro benchmarks (ENABLE_PERF_BENCH in config.h)
+// ============================================================================
+// Run from setup() before the render task takes over the display. Results go
+// to Serial only; nothing here runs in a normal build.
+
+namespace PerfBench {
+
+static const int BENCH_FRAMES = 50;
+static const int SETTLE_TICKS = 120;   // let the expression morph finish
+
+#if !OLED_PAGE_BUFFER
+// Rasterize-only cost (no I2C) of every behavior, drawRBox path vs. cached masks
+inline void eyeShapes(EyeEngine& eye, float tickDt) {
+  Serial.println("\n[BENCH] ===== Eye shape cache (us/frame, rasterize only) =====");
+  uint32_t totalLegacy = 0, totalCached = 0;
+  int count = 0;
+
+  for (int i = 0; BEHAVIORS[i].name != nullptr; i++) {
+    eye.setTarget(&BEHAVIORS[i]);
+    for (int t = 0; t < SETTLE_TICKS; t++) eye.tick(tickDt);
+    EyeFrame f = eye.snapshot();
+
+    eye.setShapeCache(false);
+    uint32_t start = micros();
+    for (int n = 0; n < BENCH_FRAMES; n++) eye.rasterize(f);
+    uint32_t legacy = (micros() - start) / BENCH_FRAMES;
+
+    eye.setShapeCache(true);
+    eye.rasterize(f); // warm the cache, steady state is what we measure
+    start = micros();
+    for (int n = 0; n < BENCH_FRAMES; n++) eye.rasterize(f);
+    uint32_t cached = (micros() - start) / BENCH_FRAMES;
+
+    Serial.printf("[BENCH] %-18s legacy=%5luus cached=%5luus\n", BEHAVIORS[i].name,
+                  (unsigned long)legacy, (unsigned long)cached);
+    totalLegacy += legacy;
+    totalCached += cached;
+    count++;
+  }
+
+  if (count > 0) {
+    Serial.printf("[BENCH] average            legacy=%5luus cached=%5luus\n",
+                  (unsigned long)(totalLegacy / count), (unsigned long)(totalCached / count));
+  }
+  const EyeShapeCacheStats& cs = eye.getShapeCacheStats();
+  Serial.printf("[BENCH] cache hits=%lu misses=%lu\n",
+                (unsigned long)cs.hits, (unsigned long)cs.misses);
+}
+#endif
+
+// One behavior's animation on a headless engine: avg renderFrame() time and
+// bytes that would go over I2C per frame
+inline void pagedRun(EyeEngine& eye, uint8_t id, float tickDt, uint32_t& us, uint32_t& bytes) {
+  static const int FRAMES = 60;
+  randomSeed(id);
+  eye.startBootSequence();
+  eye.stopClip();
+  eye.setTarget((BehaviorId)id);
+  eye.renderFrame(eye.snapshot());          // first frame is a full one on both paths
+  uint32_t bytes0 = eye.getFlushStats().bytesSent;
+  uint32_t total = 0;
+  for (int n = 0; n < FRAMES; n++) {
+    eye.tick(tickDt);
+    eye.tick(tickDt);
+    EyeFrame f = eye.snapshot();
+    uint32_t start = micros();
+    eye.renderFrame(f);
+    total += micros() - start;
+  }
+  us = total / FRAMES;
+  bytes = (eye.getFlushStats().bytesSent - bytes0) / FRAMES;
+}
+
+// Full-buffer vs page-buffer render path: time and I2C bytes per frame for
+// every behavior, and the static RAM each one needs
+inline void pageBuffer(float tickDt) {
+  Serial.println("\n[BENCH] ===== Full vs page buffer (per frame, headless, CPU only) =====");
+  U8G2_SH1106_128X64_HEADLESS_PAGED* pagedDisplay = new U8G2_SH1106_128X64_HEADLESS_PAGED();
+  pagedDisplay->begin();
+  EyeEngine* paged = new EyeEngine(*pagedDisplay);
+#if !OLED_PAGE_BUFFER
+  U8G2_SH1106_128X64_HEADLESS* fullDisplay = new U8G2_SH1106_128X64_HEADLESS();
+  fullDisplay->begin();
+  EyeEngine* full = new EyeEngine(*fullDisplay);
+#endif
+
+  uint32_t sumFull = 0, sumPaged = 0;
+  for (uint8_t id = 0; id < BEH_COUNT; id++) {
+    uint32_t pagedUs, pagedBytes, fullUs = 0, fullBytes = 0;
+    pagedRun(*paged, id, tickDt, pagedUs, pagedBytes);
+#if !OLED_PAGE_BUFFER
+    pagedRun(*full, id, tickDt, fullUs, fullBytes);
+#endif
+    sumFull += fullUs;
+    sumPaged += pagedUs;
+    Serial.printf("[BENCH] %-18s full=%5luus %4luB  paged=%5luus %4luB\n", BEHAVIORS[id].name,
+                  (unsigned long)fullUs, (unsigned long)fullBytes,
+                  (unsigned long)pagedUs, (unsigned long)pagedBytes);
+  }
+  Serial.printf("[BENCH] average            full=%5luus        paged=%5luus\n",
+                (unsigned long)(sumFull / BEH_COUNT), (unsigned long)(sumPaged / BEH_COUNT));
+
+  // Static RAM that only the full-buffer path needs
+  const uint32_t fullRam = TileFlusher::FRAME_BYTES + sizeof(TileFlusher) +
+                           sizeof(EyeShapeCache) + sizeof(StopwatchView);
+  const uint32_t pagedRam = 128u * pagedDisplay->getBufferTileHeight();
+  Serial.printf("[BENCH] RAM full=%luB (buffer %u + tile shadow %u + shape cache %u + stopwatch %u) paged=%luB -> OLED_PAGE_BUFFER frees %luB\n",
+                (unsigned long)fullRam, TileFlusher::FRAME_BYTES, (unsigned)sizeof(TileFlusher),
+                (unsigned)sizeof(EyeShapeCache), (unsigned)sizeof(StopwatchView),
+                (unsigned long)pagedRam, (unsigned long)(fullRam - pagedRam));
+
+  delete paged;
+  delete pagedDisplay;
+#if !OLED_PAGE_BUFFER
+  delete full;
+  delete fullDisplay;
+#endif
+}
+
+// Fixed-point helpers vs. the float code they replaced: cycles per call from
+// the Xtensa CCOUNT register. Accuracy is checked on the host
+// (esp32/host/fixed_math_test.cpp).
+inline void fixedMath() {
+  Serial.println("\n[BENCH] ===== Fixed math (cycles per call) =====");
+
+  const int N = 1000;
+  volatile float sinkF = 0;
+  volatile int32_t sinkQ = 0;
+
+  // Sparkle radius: fmod + sin in float vs. phase + LUT
+  uint32_t c0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) {
+    float t = i * 0.0137f;
+    float t1 = fmod(t * 3.0f, 1.0f);
+    sinkF = sin(t1 * 3.14159f / 0.6f) * 4.0f;
+  }
+  uint32_t floatCycles = (ESP.getCycleCount() - c0) / N;
+  c0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) {
+    uint32_t tq = (uint32_t)i * q16(0.0137f);
+    uint16_t phase = (uint16_t)q16Cycles(tq, q16(3.0f));
+    sinkQ = (q16Sin((uint16_t)(((uint32_t)phase * 0x8000) / (uint16_t)q16(0.6f))) * 4) >> 16;
+  }
+  uint32_t fixedCycles = (ESP.getCycleCount() - c0) / N;
+  Serial.printf("[BENCH] sparkle sin   float=%4lu cyc  fixed=%4lu cyc\n",
+                (unsigned long)floatCycles, (unsigned long)fixedCycles);
+
+  // Eye param lerp (render interpolation, 9 fields)
+  EyeParams a, b;
+  b.width = q16(34.0f); b.height = q16(22.0f); b.topLid = q16(0.4f);
+  float fa[9] = {28, 40, 0, 0, 0, 0, 0, 0, 1}, fb[9] = {34, 22, 0, 0, 0.4f, 0, 0, 0, 1}, fo[9];
+  c0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) {
+    float t = (i & 255) / 256.0f;
+    for (int k = 0; k < 9; k++) fo[k] = fa[k] + (fb[k] - fa[k]) * t;
+    sinkF = fo[i % 9];
+  }
+  floatCycles = (ESP.getCycleCount() - c0) / N;
+  c0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) {
+    EyeParams o = EyeParams::lerp(a, b, (i & 255) << 8);
+    sinkQ = o.height;
+  }
+  fixedCycles = (ESP.getCycleCount() - c0) / N;
+  Serial.printf("[BENCH] params lerp   float=%4lu cyc  fixed=%4lu cyc\n",
+                (unsigned long)floatCycles, (unsigned long)fixedCycles);
+
+  // LED breathe: sin wave + cubic ease
+  c0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) {
+    float t = i * 0.0137f;
+    float wave = (sin(t * (2.0f * PI / 7.0f)) + 1.0f) * 0.5f;
+    sinkF = wave * wave * (3.0f - 2.0f * wave);
+  }
+  floatCycles = (ESP.getCycleCount() - c0) / N;
+  c0 = ESP.getCycleCount();
+  for (int i = 0; i < N; i++) {
+    uint32_t tq = (uint32_t)i * q16(0.0137f);
+    sinkQ = q16Smoothstep(q16Wave((uint16_t)q16Cycles(tq, q16(1.0f / 7.0f))));
+  }
+  fixedCycles = (ESP.getCycleCount() - c0) / N;
+  Serial.printf("[BENCH] led breathe   float=%4lu cyc  fixed=%4lu cyc\n",
+                (unsigned long)floatCycles, (unsigned long)fixedCycles);
+  (void)sinkF;
+  (void)sinkQ;
+}
+
+// Every clip played front to back at its own rate: decode cost per frame,
+// flash bandwidth it needs, and a seek (last frame from scratch) for the
+// worst case after a skipped frame or a loop
+inline void clips() {
+  Serial.println("\n[BENCH] ===== Anim clips (decode into a 1 KB page buffer) =====");
+  uint8_t* buf = new uint8_t[ClipDecoder::FRAME_BYTES];
+  for (uint8_t id = CLIP_NONE + 1; id < CLIP_COUNT; id++) {
+    const AnimClip& clip = ANIM_CLIPS[id];
+    ClipDecoder dec;
+    for (uint16_t n = 0; n < clip.frames; n++) dec.decode(buf, clip, n);
+    const ClipStats cs = dec.stats();
+
+    dec.invalidate();
+    uint32_t start = micros();
+    dec.decode(buf, clip, clip.frames - 1);
+    uint32_t seek = micros() - start;
+
+    Serial.printf("[BENCH] %-8s %3u frames %5lu B (%4lu B/s @ %u fps) decode avg=%4luus max=%4luus seek=%4luus\n",
+                  clip.name, clip.frames, (unsigned long)clip.size,
+                  (unsigned long)(clip.size * clip.fps / clip.frames), clip.fps,
+                  (unsigned long)(cs.decodeUsTotal / clip.frames), (unsigned long)cs.decodeUsMax,
+                  (unsigned long)seek);
+  }
+  delete[] buf;
+}
+
+// Subtitle marquee: one-off strip build, then the per-frame window copy for
+// a short and a maximum-length text, against drawing the visible text with
+// the font every frame
+inline void subtitles() {
+  Serial.println("\n[BENCH] ===== Subtitle strip (bottom page row) =====");
+  static const int FRAMES = 100;
+  U8G2_SH1106_128X64_HEADLESS* display = new U8G2_SH1106_128X64_HEADLESS();
+  display->begin();
+  SubtitleStrip* strip = new SubtitleStrip();
+  char text[SUBTITLE_MAX_CHARS + 1];
+  const uint8_t lengths[2] = { 12, SUBTITLE_MAX_CHARS };
+
+  for (uint8_t n = 0; n < 2; n++) {
+    for (uint8_t i = 0; i < lengths[n]; i++) text[i] = 'a' + i % 26;
+    text[lengths[n]] = '\0';
+    uint32_t start = micros();
+    strip->build(*display, n + 1, text);
+    uint32_t buildUs = micros() - start;
+
+    uint8_t* page = display->getBufferPtr() + SubtitleStrip::PAGE * 128;
+    start = micros();
+    for (int f = 0; f < FRAMES; f++) strip->blit(page, f * 3 - 64);
+    uint32_t blitUs = micros() - start;
+
+    display->setFont(u8g2_font_5x7_tr);
+    start = micros();
+    for (int f = 0; f < FRAMES; f++) {
+      memset(page, 0, 128);
+      const uint8_t first = min<uint8_t>(lengths[n], f * 3 / SubtitleStrip::CELL_W);
+      char visible[128 / SubtitleStrip::CELL_W + 2];
+      strncpy(visible, text + first, sizeof(visible) - 1);
+      visible[sizeof(visible) - 1] = '\0';
+      display->drawStr(0, 62, visible);
+    }
+    uint32_t fontUs = micros() - start;
+
+    Serial.printf("[BENCH] %2u chars %4u cols  build=%5luus  per frame: strip=%3luus font=%4luus\n",
+                  lengths[n], strip->width(), (unsigned long)buildUs,
+                  (unsigned long)(blitUs / FRAMES), (unsigned long)(fontUs / FRAMES));
+  }
+  Serial.printf("[BENCH] strip RAM %uB\n", (unsigned)sizeof(SubtitleStrip));
+  delete strip;
+  delete display;
+}
+
+// Mic spectrum: cycles per SPECTRUM_N block against SPECTRUM_BUDGET_CYCLES
+// (the gate for ENABLE_MICROPHONE), and which band a test tone lands in
+inline void spectrum() {
+  Serial.println("\n[BENCH] ===== Mic spectrum (FFT + bands per block) =====");
+  static const int BLOCKS = 100;
+  AudioSpectrum* sp = new AudioSpectrum();
+  int16_t* block = new int16_t[AudioSpectrum::N];
+  sp->begin();
+
+  const uint16_t tones[3] = { 250, 1000, 4000 };
+  for (uint8_t n = 0; n < 3; n++) {
+    for (uint16_t i = 0; i < AudioSpectrum::N; i++) {
+      block[i] = (int16_t)(8000.0f * sinf(2.0f * PI * tones[n] * i / MIC_SAMPLE_RATE));
+    }
+    for (int b = 0; b < SPECTRUM_PEAK_HOLD + 30; b++) sp->process(block);  // settle levels
+    uint8_t best = 0;
+    for (uint8_t b = 1; b < AudioSpectrum::BANDS; b++) {
+      if (sp->levels()[b] > sp->levels()[best]) best = b;
+    }
+    Serial.printf("[BENCH] %4u Hz tone -> band %2u (%4u-%4u Hz) level=%u\n", tones[n], best,
+                  sp->bandLowHz(best), best + 1 < AudioSpectrum::BANDS ? sp->bandLowHz(best + 1) : MIC_SAMPLE_RATE / 2,
+                  sp->levels()[best]);
+  }
+
+  // Noise-like input, cycle cost is the same for any signal
+  uint32_t seed = 1, total = 0, worst = 0;
+  for (int b = 0; b < BLOCKS; b++) {
+    for (uint16_t i = 0; i < AudioSpectrum::N; i++) {
+      seed = seed * 1664525UL + 1013904223UL;
+      block[i] = (int16_t)(seed >> 16) >> 2;
+    }
+    sp->process(block);
+    total += sp->stats().cyclesLast;
+    worst = max<uint32_t>(worst, sp->stats().cyclesLast);
+  }
+  const uint32_t blockCycles = (uint32_t)((uint64_t)ESP.getCpuFreqMHz() * 1000000ULL * AudioSpectrum::N / MIC_SAMPLE_RATE);
+  Serial.printf("[BENCH] %u-point block avg=%lu cyc max=%lu cyc (%lu us), budget %lu cyc: %s, %lu%% of the block time\n",
+                AudioSpectrum::N, (unsigned long)(total / BLOCKS), (unsigned long)worst,
+                (unsigned long)(worst / ESP.getCpuFreqMHz()), (unsigned long)SPECTRUM_BUDGET_CYCLES,
+                worst <= SPECTRUM_BUDGET_CYCLES ? "PASS" : "FAIL",
+                (unsigned long)((uint64_t)worst * 100 / blockCycles));
+  Serial.printf("[BENCH] spectrum RAM %uB\n", (unsigned)sizeof(AudioSpectrum));
+  delete[] block;
+  delete sp;
+}
+
+inline void runAll(EyeEngine& eye, float tickDt) {
+  fixedMath();
+#if !OLED_PAGE_BUFFER
+  eyeShapes(eye, tickDt);
+#endif
+  clips();
+  pageBuffer(tickDt);
+  subtitles();
+  spectrum();
+}
+
+} // namespace PerfBench
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef POWER_BUDGET_H
+#define POWER_BUDGET_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "led_controller.h"
+#include "servo_controller.h"
+
+// ============================================================================
+// POWER BUDGET - Keeps the ring, the servo and the amplifier under the supply
+// ============================================================================
+// The LED ring, a servo starting out of rest and the I2S amplifier all draw
+// current peaks, and together they sag the 5 V rail far enough to trip the
+// brownout detector. Once per loop() the budget estimates each load from
+// what it is doing:
+//
+//   base    ESP32 + WiFi TX bursts + OLED, constant
+//   leds    the last frame drawn (LedController::currentMa())
+//   servo   the start spike for POWER_SERVO_START_MS after a move begins,
+//           then the running current, a trickle at rest
+//   audio   the amplifier while a stream plays
+//
+// and arbitrates. Audio can't wait and the base can't shrink, so the ring
+// gets what is left after them and the servo, applied to the next frame it
+// draws. While the ring may draw more than a start out of rest would leave
+// it, starts are held (ServoController::holdStarts()), renewed every pass so
+// the planner can't slip one in between two of them. Once a move is waiting
+// the hold is no longer renewed: it ends when the dimmer frame is out, or
+// after POWER_SERVO_DEFER_MS. Whatever still doesn't fit is a violation:
+// counted, timed, logged once per episode and reported with the rest of the
+// figures in the "power" websocket message.
+
+enum PowerLoad : uint8_t {
+  LOAD_BASE,
+  LOAD_LEDS,
+  LOAD_SERVO,
+  LOAD_AUDIO,
+  LOAD_COUNT
+};
+
+static const char* const POWER_LOAD_NAMES[LOAD_COUNT] = { "base", "leds", "servo", "audio" };
+
+struct PowerStats {
+  uint16_t loadMa[LOAD_COUNT] = {};   // last estimate per load
+  uint16_t totalMa = 0;
+  uint16_t peakMa = 0;                // since the last report
+  uint16_t worstMa = 0;               // highest total while over budget
+  uint32_t violations = 0;            // episodes over budget
+  uint32_t overMs = 0;                // time spent over budget
+  uint32_t servoHolds = 0;            // starts held back for the ring to dim
+};
+
+class PowerBudget {
+public:
+  void begin(uint16_t budgetMa) {
+    budgetMa_ = budgetMa;
+    lastMs_ = millis();
+    Serial.printf("[POWER] Budget %u mA (base %u, servo start %u, audio %u)\n",
+                  budgetMa_, POWER_BASE_MA, POWER_SERVO_START_MA, POWER_AUDIO_MA);
+  }
+
+  // Once per loop(), before the LED render
+  void update(LedController& leds, ServoController& servo, bool audioPlaying) {
+    const unsigned long now = millis();
+    const bool pending = servo.startPending();
+    const bool moving = servo.isMoving() && !pending;
+    if (moving && !wasMoving_) moveStartMs_ = now;
+    wasMoving_ = moving;
+
+    uint16_t servoMa = POWER_SERVO_HOLD_MA;
+    if (moving) servoMa = (now - moveStartMs_ < POWER_SERVO_START_MS) ? POWER_SERVO_START_MA : POWER_SERVO_MOVE_MA;
+    const uint16_t audioMa = audioPlaying ? POWER_AUDIO_MA : 0;
+
+    // The ring gets what is left, counting a start that is waiting
+    const int32_t rest = (int32_t)budgetMa_ - POWER_BASE_MA - audioMa;
+    const uint16_t startLimit = max<int32_t>(rest - POWER_SERVO_START_MA, POWER_LED_FLOOR_MA);
+    const uint16_t ledLimit = pending ? startLimit : max<int32_t>(rest - servoMa, POWER_LED_FLOOR_MA);
+    leds.setCurrentLimit(ledLimit);
+
+    // Stagger: a start waits until the ring shows the dimmer frame
+    const uint16_t ledMa = leds.currentMa();
+    if (pending) {
+      if (ledMa <= startLimit) {
+        if (gated_) servo.holdStarts(0);
+        gated_ = false;
+      } else if (!holding_) {
+        holding_ = true;
+        stats_.servoHolds++;
+      }
+    } else {
+      holding_ = false;
+      gated_ = ledLimit > startLimit;
+      servo.holdStarts(gated_ ? POWER_SERVO_DEFER_MS : 0);
+    }
+
+    stats_.loadMa[LOAD_BASE] = POWER_BASE_MA;
+    stats_.loadMa[LOAD_LEDS] = ledMa;
+    stats_.loadMa[LOAD_SERVO] = servoMa;
+    stats_.loadMa[LOAD_AUDIO] = audioMa;
+    const uint16_t total = POWER_BASE_MA + ledMa + servoMa + audioMa;
+    stats_.totalMa = total;
+    if (total > stats_.peakMa) stats_.peakMa = total;
+
+    if (total > budgetMa_) {
+      if (over_) stats_.overMs += now - lastMs_;
+      else {
+        stats_.violations++;
+        Serial.printf("[POWER] Over budget: %u of %u mA (leds %u, servo %u, audio %u)\n",
+                      total, budgetMa_, ledMa, servoMa, audioMa);
+      }
+      if (total > stats_.worstMa) stats_.worstMa = total;
+    }
+    over_ = total > budgetMa_;
+    lastMs_ = now;
+  }
+
+  // Call after each report: the peak covers one report interval
+  void resetPeak() { stats_.peakMa = stats_.totalMa; }
+
+  uint16_t budgetMa() const { return budgetMa_; }
+  const PowerStats& stats() const { return stats_; }
+
+private:
+  uint16_t budgetMa_ = POWER_BUDGET_MA;
+  bool wasMoving_ = false;
+  unsigned long moveStartMs_ = 0;
+  bool gated_ = false;                // starts held until the ring dims
+  bool holding_ = false;              // a start is waiting on the gate
+  bool over_ = false;
+  unsigned long lastMs_ = 0;
+  PowerStats stats_;
+};
+
+#endif
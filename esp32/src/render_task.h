@@ -0,0 +1,184 @@
+#ifndef RENDER_TASK_H
+#define RENDER_TASK_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "config.h"
+#include "eye_engine.h"
+
+// ============================================================================
+// RENDER TASK - Rasterizes and sends OLED frames off the main loop
+// ============================================================================
+// The main loop only publishes immutable EyeFrame snapshots. The render task
+// owns the display: the U8g2 draw buffer it rasterizes into and the
+// TileFlusher shadow of what the panel shows (the two framebuffers), plus the
+// whole I2C transfer. Audio decoding and websocket handling never wait on it.
+// With an async OledBus attached the transfer itself moves one step further
+// out: a frame refused for back-pressure stays pending and is retried (as
+// the newest snapshot) when the bus task signals a free staging buffer.
+
+// Lock-free single-producer / single-consumer "latest value" handoff
+// (triple buffer). The writer always has a free slot, the reader always gets
+// the newest complete snapshot; intermediate ones are simply overwritten.
+template <typename T>
+class SnapshotMailbox {
+public:
+  // Slot owned by the writer until publish()
+  T& writeSlot() { return slots_[back_]; }
+
+  void publish() {
+    back_ = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+  }
+
+  // Returns true and swaps in the newest snapshot if one was published
+  bool fetch() {
+    if (!(middle_.load(std::memory_order_acquire) & FRESH)) return false;
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+  }
+
+  const T& readSlot() const { return slots_[front_]; }
+
+private:
+  static const uint8_t INDEX_MASK = 0x03;
+  static const uint8_t FRESH = 0x04;
+
+  T slots_[3];
+  uint8_t back_ = 0;                   // writer side
+  uint8_t front_ = 1;                  // reader side
+  std::atomic<uint8_t> middle_{2};     // shared slot index | FRESH
+};
+
+struct RenderStats {
+  uint32_t frames = 0;          // frames rasterized and flushed
+  uint32_t published = 0;       // snapshots handed over by the main loop
+  uint32_t superseded = 0;      // snapshots replaced before being rendered
+  uint32_t deferred = 0;        // render attempts refused by a busy OledBus
+  uint32_t frameUs = 0;         // last rasterize + flush time
+  uint32_t frameUsAvg = 0;      // moving average (1/8)
+  uint32_t frameUsMax = 0;
+  uint32_t latencyUs = 0;       // last publish -> render start
+  uint32_t latencyUsAvg = 0;
+  uint32_t latencyUsMax = 0;
+};
+
+class RenderTask {
+public:
+  bool begin(EyeEngine& eye) {
+    eye_ = &eye;
+    BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "render", RENDER_TASK_STACK, this,
+                                            RENDER_TASK_PRIORITY, &handle_, RENDER_TASK_CORE);
+    if (ok != pdPASS) {
+      handle_ = nullptr;
+      Serial.println("[RENDER] Task creation failed - rendering inline");
+      return false;
+    }
+    if (eye.bus()) eye.bus()->setWaiter(handle_);
+    Serial.printf("[RENDER] Task started on core %d (prio %d)\n", RENDER_TASK_CORE, RENDER_TASK_PRIORITY);
+    return true;
+  }
+
+  bool running() const { return handle_ != nullptr; }
+
+  // Main loop side: hand over the latest frame and wake the task
+  void publish(const EyeFrame& frame) {
+    EyeFrame& slot = mailbox_.writeSlot();
+    slot = frame;
+    slot.publishedUs = micros();
+    slot.seq = ++seq_;
+    mailbox_.publish();
+    stats_.published++;
+    xTaskNotifyGive(handle_);
+  }
+
+  const RenderStats& stats() const { return stats_; }
+
+private:
+  EyeEngine* eye_ = nullptr;
+  TaskHandle_t handle_ = nullptr;
+  SnapshotMailbox<EyeFrame> mailbox_;
+  uint32_t seq_ = 0;
+  uint32_t lastSeq_ = 0;
+  RenderStats stats_;
+
+  static void taskEntry(void* arg) {
+    static_cast<RenderTask*>(arg)->run();
+  }
+
+  void run() {
+    unsigned long lastDebug = 0;
+    bool pending = false;
+    for (;;) {
+      // Sleep until the main loop publishes (timeout keeps stats printing alive)
+      // (or the OLED bus frees a staging buffer while a frame is pending)
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(250));
+      if (mailbox_.fetch()) pending = true;
+      if (pending) pending = !renderOne(mailbox_.readSlot());
+
+      if (millis() - lastDebug > 10000) {
+        printStats();
+        lastDebug = millis();
+      }
+    }
+  }
+
+  bool renderOne(const EyeFrame& f) {
+    uint32_t start = micros();
+    uint32_t latency = start - f.publishedUs;
+
+    if (!eye_->renderFrame(f)) {
+      stats_.deferred++;
+      return false;
+    }
+    if (lastSeq_ != 0 && f.seq > lastSeq_ + 1) stats_.superseded += f.seq - lastSeq_ - 1;
+    lastSeq_ = f.seq;
+
+    uint32_t frameUs = micros() - start;
+    stats_.frames++;
+    stats_.frameUs = frameUs;
+    stats_.frameUsAvg += ((int32_t)frameUs - (int32_t)stats_.frameUsAvg) / 8;
+    if (frameUs > stats_.frameUsMax) stats_.frameUsMax = frameUs;
+    stats_.latencyUs = latency;
+    stats_.latencyUsAvg += ((int32_t)latency - (int32_t)stats_.latencyUsAvg) / 8;
+    if (latency > stats_.latencyUsMax) stats_.latencyUsMax = latency;
+    return true;
+  }
+
+  void printStats() {
+    const FlushStats& fs = eye_->getFlushStats();
+    Serial.printf("[RENDER] frames=%lu superseded=%lu deferred=%lu frame=%luus (avg %lu, max %lu) latency=%luus (avg %lu, max %lu)\n",
+                  (unsigned long)stats_.frames, (unsigned long)stats_.superseded, (unsigned long)stats_.deferred,
+                  (unsigned long)stats_.frameUs, (unsigned long)stats_.frameUsAvg, (unsigned long)stats_.frameUsMax,
+                  (unsigned long)stats_.latencyUs, (unsigned long)stats_.latencyUsAvg, (unsigned long)stats_.latencyUsMax);
+    Serial.printf("[EYE FLUSH] elided=%lu frames=%lu full=%lu bytes=%lu tilesSent=%lu tilesSkipped=%lu areas=%lu\n",
+                  (unsigned long)eye_->getElidedFrames(), (unsigned long)fs.frames, (unsigned long)fs.fullFrames,
+                  (unsigned long)fs.bytesSent, (unsigned long)fs.tilesSent,
+                  (unsigned long)fs.tilesSkipped, (unsigned long)fs.areaCalls);
+    const ClipStats& cs = eye_->getClipStats();
+    if (cs.framesShown) {
+      Serial.printf("[CLIP] shown=%lu decoded=%lu flashBytes=%lu decode=%luus (avg %lu, max %lu)\n",
+                    (unsigned long)cs.framesShown, (unsigned long)cs.framesDecoded,
+                    (unsigned long)cs.bytesRead, (unsigned long)cs.decodeUs,
+                    (unsigned long)(cs.decodeUsTotal / cs.framesShown), (unsigned long)cs.decodeUsMax);
+    }
+    if (OledBus* bus = eye_->bus()) {
+      const OledBusStats& bs = bus->stats();
+      Serial.printf("[I2C] frames=%lu refused=%lu transactions=%lu bytes=%lu busy=%u%% errors=%lu overflows=%lu\n",
+                    (unsigned long)bs.frames, (unsigned long)bs.refused, (unsigned long)bs.transactions,
+                    (unsigned long)bs.bytes, bus->utilizationPct(), (unsigned long)bs.errors,
+                    (unsigned long)bs.overflows);
+    }
+    if (OledMirror* mirror = eye_->mirror()) {
+      const MirrorStats& ms = mirror->stats();
+      if (ms.packets) {
+        Serial.printf("[MIRROR] packets=%lu keyframes=%lu bytes=%lu skipped=%lu busy=%lu\n",
+                      (unsigned long)ms.packets, (unsigned long)ms.keyframes, (unsigned long)ms.bytes,
+                      (unsigned long)ms.skipped, (unsigned long)ms.busy);
+      }
+    }
+  }
+};
+
+#endif
@@ -2,210 +2,435 @@
 #define SERVO_CONTROLLER_H
 
 #include <ESP32Servo.h>
+#include <atomic>
+#include <esp_timer.h>
+#include "config.h"
 #include "pins.h"
+#include "fixed_math.h"
+#include "servo_gestures.h"
 
 // ============================================================================
 // SERVO CONTROLLER - Optimized for Cardboard Body (Left/Right Only)
 // ============================================================================
+// Every move is planned as one minimum-jerk segment (zero velocity and
+// acceleration at both ends): s(u) = 10u^3 - 15u^4 + 6u^5 over a fixed
+// number of planner steps, in Q16 degrees. A 50 Hz esp_timer callback
+// (SERVO_TIMER) steps the segment and writes the pulse in whole
+// microseconds (~0.1° of travel), only when it changed, so the head moves
+// at the servo's own frame rate whatever loop() is doing and a resting servo
+// costs no LEDC writes.
+//
+// The main loop never touches the running segment: a move is one packed
+// word (target Q8.8 degrees, duration ms, or a gesture id) swapped into an
+// atomic, which the timer picks up on its next step and starts from
+// wherever the head is. Without the timer, update() runs the same steps
+// from loop().
+//
+// Gestures (servo_gestures.h) run on the same step: whenever a segment
+// ends, the interpreter executes ops until the next one starts - at most
+// GESTURE_OPS_PER_STEP, so a step never costs more than that.
+//
+// Starting from rest is the servo's current spike. holdStarts() lets
+// PowerBudget keep a new move waiting a few ms while something else peaks;
+// the hold carries its own deadline, so a stalled loop can't freeze the head.
+//
+// Every SERVO_STATS_MS update() prints the planner's counters for the last
+// interval: LEDC writes and planner steps per second, moves, gestures and
+// steps spent held.
+
+struct ServoStats {
+  uint32_t segments = 0;        // moves planned
+  uint32_t steps = 0;           // planner steps run
+  uint32_t writes = 0;          // pulse widths sent to the LEDC
+  uint32_t gestures = 0;        // gestures started
+  uint32_t heldSteps = 0;       // steps a start waited on holdStarts()
+};
+
 class ServoController {
 public:
   void begin() {
-    servo_.setPeriodHertz(50); 
-    servo_.attach(PIN_SERVO, 600, 2300); 
-    targetAngle_ = 90.0f;
-    currentAngle_ = 90.0f;
-    servo_.write(90);
-    isIdleMovement_ = false;
-    lastFailsafeCheck_ = 0;
-    Serial.printf("[SERVO] Initialized on pin %d at 90° (Range: 60-120° for cardboard)\n", PIN_SERVO);
+    servo_.setPeriodHertz(50);
+    servo_.attach(PIN_SERVO, MIN_US, MAX_US);
+    pos_.store(q16FromInt(CENTER), std::memory_order_relaxed);
+    target_ = q16FromInt(CENTER);
+    writePulse(q16FromInt(CENTER));
+#if SERVO_TIMER
+    startTimer();
+#endif
+    Serial.printf("[SERVO] Initialized on pin %d at 90° (Range: 60-120° for cardboard), %s planner\n",
+                  PIN_SERVO, timer_ ? "timer" : "loop");
   }
 
   // Set target angle with behavior-synced auto-return
   void setTarget(int angle, unsigned long returnDelay = 0) {
     // CARDBOARD SAFE: Constrain to 60-120° to prevent tearing
-    targetAngle_ = constrain(angle, 60, 120);
-    isIdleMovement_ = false; // Mark as emotion-triggered movement
-    
+    moveTo(constrain(angle, 60, 120), 0);
+
     // Set up auto-return if delay specified
     if (returnDelay > 0) {
       returnToCenter_ = true;
       returnTime_ = millis() + returnDelay;
     }
-    
-    // CRITICAL FIX: Don't reset moveState if a gesture is active
-    if (moveState_ == MOVE_IDLE) {
-      Serial.printf("[SERVO] Target set: %d° (return in %lums)\n", angle, returnDelay);
-    }
+    Serial.printf("[SERVO] Target set: %d° (return in %lums)\n", angle, returnDelay);
   }
-  
+
   // Gentle idle movement for autonomous eye movements
   void setIdleMovement(int angle, unsigned long returnDelay = 3000) {
-    targetAngle_ = constrain(angle, 78, 102); // Smaller range for idle movements
-    isIdleMovement_ = true; // Mark as gentle idle movement
-    
+    plan(constrain(angle, 78, 102), 0, SERVO_IDLE_SPEED_DPS); // Smaller range, slower
+
     if (returnDelay > 0) {
       returnToCenter_ = true;
       returnTime_ = millis() + returnDelay;
     }
-    
+
     Serial.printf("[SERVO] Idle movement to: %d° (gentle return in %lums)\n", angle, returnDelay);
   }
-  
+
   // Overload for simple calls without return delay
   void setTarget(int angle) {
     setTarget(angle, 0);
   }
 
-  // Trigger behavior-synced gestures (cardboard-optimized: left-right only)
-  void triggerGesture(const char* name, unsigned long behaviorDuration = 3000) {
-    Serial.printf("[SERVO] Gesture triggered: %s (behavior duration: %lums)\n", name, behaviorDuration);
-    
-    // NOTE: "nod" removed - requires vertical movement not possible with cardboard
-    if (strcmp(name, "nod") == 0) {
-      // Convert nod to a gentle shake for cardboard compatibility
-      moveState_ = MOVE_SHAKE;
-      gestureTimer_ = 0;
-      gestureSpeed_ = 4.0f; // Much slower for natural movement
-      gestureDuration_ = 1.2f; // Longer duration
-      returnTime_ = millis() + behaviorDuration;
-      returnToCenter_ = true;
-      isIdleMovement_ = false;
-      Serial.println("[SERVO] NOD converted to gentle SHAKE for cardboard");
-    } 
-    else if (strcmp(name, "shake") == 0) {
-      moveState_ = MOVE_SHAKE;
-      gestureTimer_ = 0;
-      gestureSpeed_ = 5.0f; // Slower shake for natural movement
-      gestureDuration_ = 1.5f; // Longer duration
-      returnTime_ = millis() + behaviorDuration;
-      returnToCenter_ = true;
-      isIdleMovement_ = false;
-      Serial.println("[SERVO] SHAKE gesture starting");
-    } 
-    else if (strcmp(name, "tilt") == 0) {
-      // Tilt right (curious look)
-      targetAngle_ = 105; 
-      moveState_ = MOVE_IDLE;
-      returnTime_ = millis() + behaviorDuration;
-      returnToCenter_ = true;
-      Serial.println("[SERVO] TILT to 105° (cardboard safe)");
+  // Move to angle over durationMs (0 = at SERVO_SPEED_DPS peak). No
+  // auto-return, no log line: timeline servo tracks call this for each key.
+  void moveTo(float angle, uint16_t durationMs) {
+    plan(angle, durationMs, SERVO_SPEED_DPS);
+    returnToCenter_ = false;
+  }
+
+  // Run a gesture from the flash table (or GESTURE_UPLOADED)
+  void playGesture(GestureId id) {
+    if (id > GESTURE_UPLOADED || (id == GESTURE_UPLOADED && !ramLen_)) return;
+    returnToCenter_ = false;
+    target_ = TARGET_UNKNOWN;
+    request_.store(REQ_GESTURE | id, std::memory_order_release);
+  }
+
+  // Websocket upload ('G', version, code): checked against the cardboard
+  // limits, then kept as GESTURE_UPLOADED (replacing the last upload)
+  bool loadGesture(const uint8_t* blob, uint16_t len) {
+    uint32_t ms = 0;
+    if (len <= GESTURE_HEADER_BYTES || len - GESTURE_HEADER_BYTES > GESTURE_MAX_BYTES ||
+        blob[0] != GESTURE_MAGIC || blob[1] != GESTURE_VERSION ||
+        !validGesture(blob + GESTURE_HEADER_BYTES, len - GESTURE_HEADER_BYTES, &ms)) {
+      Serial.printf("[SERVO] Rejected %u byte gesture upload\n", len);
+      return false;
     }
+    // The planner may be reading the old upload (or about to): request
+    // first, since the timer flags it as running before taking the request
+    if (request_.load() == (REQ_GESTURE | GESTURE_UPLOADED) || runningUpload_.load()) {
+      Serial.println("[SERVO] Uploaded gesture still running, upload dropped");
+      return false;
+    }
+    ramLen_ = len - GESTURE_HEADER_BYTES;
+    memcpy(ram_, blob + GESTURE_HEADER_BYTES, ramLen_);
+    Serial.printf("[SERVO] Gesture uploaded: %u bytes, %lu ms\n", ramLen_, (unsigned long)ms);
+    return true;
+  }
+
+  // Keep moves from starting out of rest for the next ms (0 = release).
+  // Moves already under way are not affected.
+  void holdStarts(uint16_t ms) {
+    holdUntilUs_.store(ms ? (micros() + ms * 1000UL) | 1 : 0, std::memory_order_release);
+  }
+
+  // A move or gesture is waiting to start from rest (the start spike is next)
+  bool startPending() {
+    return request_.load(std::memory_order_acquire) != 0 && !moving_.load(std::memory_order_acquire);
   }
 
-  void loop(float dt) {
+  // Last OP_SYNC marker the running gesture passed, 0 = none since last call
+  uint8_t takeSync() { return sync_.exchange(0, std::memory_order_acquire); }
+
+  // Loop side: auto-return, and the planner itself when there is no timer
+  void update() {
     unsigned long now = millis();
-    
-    // 1. Auto-return failsafe check (every 500ms)
-    if (now - lastFailsafeCheck_ > 500) {
-      lastFailsafeCheck_ = now;
-      
-      // Failsafe: ensure servo returns to center if stuck or timer fails
-      if (returnToCenter_ && now >= returnTime_ + 1000) { // 1 sec grace period
-        Serial.println("[SERVO] FAILSAFE: Force return to center");
-        targetAngle_ = 90.0f;
-        returnToCenter_ = false;
-        moveState_ = MOVE_IDLE;
-      }
-    }
-    
-    // 2. Handle auto-return to center
-    if (returnToCenter_ && now >= returnTime_ && moveState_ == MOVE_IDLE) {
-      if (abs(targetAngle_ - 90.0f) > 2.0f) {
-        Serial.println("[SERVO] Auto-returning to center (90°)");
-        targetAngle_ = 90.0f;
-      }
+    if (returnToCenter_ && (long)(now - returnTime_) >= 0) {
       returnToCenter_ = false;
-    }
-    
-    // 3. Procedural Gestures (left-right only for cardboard)
-    if (moveState_ != MOVE_IDLE) {
-      gestureTimer_ += dt;
-      
-      if (moveState_ == MOVE_SHAKE) {
-        // Shake: side to side within safe range with easing
-        float progress = gestureTimer_ / gestureDuration_;
-        float easeMultiplier = 1.0f - (progress * progress); // Quadratic ease-out
-        float wave = cos(gestureTimer_ * gestureSpeed_) * 15.0f * easeMultiplier;
-        targetAngle_ = constrain(90.0f + wave, 60.0f, 120.0f);
-        
-        if (gestureTimer_ > gestureDuration_) {
-          moveState_ = MOVE_IDLE;
-          Serial.println("[SERVO] SHAKE complete, waiting for behavior timeout");
-        }
+      if (abs(target_ - q16FromInt(CENTER)) > q16FromInt(2)) {
+        Serial.println("[SERVO] Auto-returning to center (90°)");
+        moveTo(CENTER, 0);
       }
     }
-
-    // 4. Smooth Movement Physics with Easing
-    float diff = targetAngle_ - currentAngle_;
-    
-    // Slower speeds for natural movement with easing
-    float baseSpeed = isIdleMovement_ ? 1.5f : 3.0f; // Even slower for idle movements
-    
-    // Apply ease-in/ease-out for natural acceleration/deceleration
-    float distanceRatio = abs(diff) / 30.0f; // Normalize distance
-    float easeFactor = 1.0f - pow(1.0f - distanceRatio, 3.0f); // Cubic ease-in
-    float speed = baseSpeed * (0.3f + 0.7f * easeFactor); // Speed varies from 30% to 100% of base
-    
-    if (abs(diff) > 0.5f) {
-      float movement = diff * (speed * dt);
-      
-      // Apply smooth acceleration/deceleration
-      if (abs(diff) < 5.0f) {
-        movement *= 0.5f; // Slow down near target
-      }
-      
-      currentAngle_ += movement;
-      currentAngle_ = constrain(currentAngle_, 60.0f, 120.0f); // Safety clamp
-      servo_.write((int)currentAngle_);
-      
-      // Debug output for movement
-      static unsigned long lastDebug = 0;
-      if (millis() - lastDebug > 1000) {
-        Serial.printf("[SERVO] %s: current=%.1f° target=%.1f° speed=%.2f\n", 
-                     isIdleMovement_ ? "IDLE" : "ACTIVE", currentAngle_, targetAngle_, speed);
-        lastDebug = millis();
-      }
+    if (now - lastStatsMs_ > SERVO_STATS_MS) report(now);
+    if (timer_) return;
+    uint32_t nowUs = micros();
+    uint8_t due = 0;
+    while ((uint32_t)(nowUs - lastStepUs_) >= PERIOD_US && due < MAX_CATCH_UP) {
+      lastStepUs_ += PERIOD_US;
+      step();
+      due++;
     }
+    if (due == MAX_CATCH_UP) lastStepUs_ = nowUs;     // after a stall, don't replay it
   }
 
   // Check if servo is currently moving
   bool isMoving() {
-    return (moveState_ != MOVE_IDLE) || (abs(targetAngle_ - currentAngle_) > 2.0f);
+    return moving_.load(std::memory_order_acquire) || request_.load(std::memory_order_acquire) != 0;
   }
 
   // Get current angle for debugging
   float getCurrentAngle() {
-    return currentAngle_;
+    return q16ToFloat(pos_.load(std::memory_order_relaxed));
   }
-  
+
   // Force return to center (called when behavior ends)
   void returnToCenter() {
-    targetAngle_ = 90.0f;
-    returnToCenter_ = false;
-    moveState_ = MOVE_IDLE;
+    moveTo(CENTER, 0);
     Serial.println("[SERVO] Forced return to center");
   }
 
+  const ServoStats& stats() const { return stats_; }
+
 private:
+  static const int CENTER = 90;
+  static const int MIN_US = 600, MAX_US = 2300;     // 0° .. 180°
+  static const uint32_t PERIOD_US = 1000000 / SERVO_PLANNER_HZ;
+  static const uint8_t MAX_CATCH_UP = 2;
+  // Pulse microseconds per degree, Q16
+  static const q16_t US_PER_DEG = ((MAX_US - MIN_US) << 16) / 180;
+  static const uint32_t REQ_GESTURE = 0x80000000;  // moves: target < 128° keeps bit 31 clear
+  static const q16_t TARGET_UNKNOWN = INT32_MIN;
+
   Servo servo_;
-  float currentAngle_ = 90.0f;
-  float targetAngle_ = 90.0f;
-  float gestureTimer_ = 0.0f;
-  float gestureSpeed_ = 15.0f;
-  float gestureDuration_ = 0.8f;
-  
-  // Auto-return system with failsafe
+  esp_timer_handle_t timer_ = nullptr;
+  ServoStats stats_;
+
+  // Loop side
+  ServoStats reported_;               // stats_ at the last [SERVO] line
+  unsigned long lastStatsMs_ = 0;
+  q16_t target_ = 0;                  // last target handed to the planner
+  uint32_t lastStepUs_ = 0;
+  std::atomic<uint32_t> request_{0};  // target Q8.8 << 16 | ms, REQ_GESTURE | id; 0 = none
+  uint8_t ram_[GESTURE_MAX_BYTES];    // uploaded gesture code
+  uint8_t ramLen_ = 0;
+
+  // Auto-return
   bool returnToCenter_ = false;
   unsigned long returnTime_ = 0;
-  unsigned long lastFailsafeCheck_ = 0;
-  
-  // Movement type tracking
-  bool isIdleMovement_ = false; // True for gentle autonomous movements
-  
-  enum MoveState { 
-    MOVE_IDLE, 
-    MOVE_SHAKE 
-  } moveState_ = MOVE_IDLE;
+
+  // Planner side (timer task)
+  std::atomic<q16_t> pos_{0};         // degrees, Q16
+  std::atomic<bool> moving_{false};
+  q16_t from_ = 0, delta_ = 0;
+  q16_t stepU_ = 0;                   // u per step, Q16
+  uint16_t k_ = 0, n_ = 0;            // steps taken / in the segment
+  ServoEase segEase_ = SERVO_EASE_MIN_JERK;
+  int lastPulse_ = -1;
+
+  // Gesture interpreter (timer task)
+  const uint8_t* prog_ = nullptr;
+  uint8_t pc_ = 0;
+  ServoEase ease_ = SERVO_EASE_MIN_JERK;
+  uint8_t repeatLeft_ = 0;
+  bool looping_ = false;
+  q16_t oscCenter_ = 0, oscAmp_ = 0;
+  uint16_t oscHalfMs_ = 0;
+  uint8_t oscKeep_ = 0, oscSwing_ = 0, oscSwings_ = 0;   // swing oscSwings_ = back to centre
+  std::atomic<bool> runningUpload_{false};
+  std::atomic<uint8_t> sync_{0};
+  std::atomic<uint32_t> holdUntilUs_{0};   // micros(); 0 = starts not held
+
+  // Hand a move to the planner (loop side)
+  void plan(float angle, uint16_t durationMs, uint32_t dps) {
+    const q16_t target = q16FromFloat(constrain(angle, 60.0f, 120.0f));
+    if (target == target_ && !durationMs) return;   // already going there
+    target_ = target;
+    if (!durationMs) {
+      // Min-jerk peak speed is 1.875x the average
+      const uint32_t dist = abs(target - pos_.load(std::memory_order_relaxed));
+      durationMs = max<uint32_t>(SERVO_MIN_MOVE_MS, ((uint64_t)dist * 1875 / dps) >> 16);
+    }
+    request_.store(((uint32_t)(target >> 8) << 16) | durationMs, std::memory_order_release);
+  }
+
+  bool startTimer() {
+    esp_timer_create_args_t args = {};
+    args.callback = timerEntry;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "servo";
+    if (esp_timer_create(&args, &timer_) != ESP_OK || !timer_ ||
+        esp_timer_start_periodic(timer_, PERIOD_US) != ESP_OK) {
+      timer_ = nullptr;
+      Serial.println("[SERVO] Timer start failed - planning from loop()");
+      return false;
+    }
+    return true;
+  }
+
+  static void timerEntry(void* arg) {
+    static_cast<ServoController*>(arg)->step();
+  }
+
+  // One planner step: pick up a new move, advance the segment, write
+  void step() {
+    stats_.steps++;
+    if (k_ >= n_ && !prog_ && startHeld()) return;
+    uint32_t req = request_.load(std::memory_order_acquire);
+    if (req == (REQ_GESTURE | GESTURE_UPLOADED)) runningUpload_.store(true);
+    req = request_.exchange(0, std::memory_order_acquire);
+    if (req & REQ_GESTURE) {
+      startGesture(req & 0xFF);
+    } else if (req) {
+      endGesture();
+      startSegment((q16_t)(req >> 16) << 8, req & 0xFFFF, SERVO_EASE_MIN_JERK);
+    }
+    if (k_ >= n_ && prog_) runGesture();
+    if (k_ >= n_) return;
+
+    k_++;
+    const q16_t u = (k_ == n_) ? Q16_ONE : k_ * stepU_;
+    const q16_t pos = from_ + q16Mul(delta_, ease(segEase_, u));
+    pos_.store(pos, std::memory_order_relaxed);
+    writePulse(pos);
+    if (k_ == n_ && !prog_) moving_.store(false, std::memory_order_release);
+  }
+
+  void startSegment(q16_t target, uint16_t ms, ServoEase e) {
+    from_ = pos_.load(std::memory_order_relaxed);
+    delta_ = target - from_;
+    n_ = max<uint32_t>(1, (ms * 1000UL + PERIOD_US / 2) / PERIOD_US);
+    stepU_ = Q16_ONE / n_;
+    k_ = 0;
+    segEase_ = e;
+    stats_.segments++;
+    moving_.store(true, std::memory_order_release);
+  }
+
+  void startGesture(uint8_t id) {
+    endGesture();
+    if (id == GESTURE_UPLOADED) runningUpload_.store(true);
+    prog_ = (id == GESTURE_UPLOADED) ? ram_ : GESTURES[id].code;
+    pc_ = 0;
+    ease_ = SERVO_EASE_MIN_JERK;
+    looping_ = false;
+    oscSwings_ = 0;
+    n_ = 0;                                  // the gesture's first op starts now
+    stats_.gestures++;
+    moving_.store(true, std::memory_order_release);
+  }
+
+  void endGesture() {
+    prog_ = nullptr;
+    runningUpload_.store(false);
+  }
+
+  // Execute ops until one starts a segment (or the per-step op budget ends)
+  void runGesture() {
+    for (uint8_t i = 0; i < GESTURE_OPS_PER_STEP; i++) {
+      if (oscSwings_) {
+        oscSwing();
+        return;
+      }
+      const uint8_t* op = prog_ + pc_;
+      uint8_t next = pc_ + GESTURE_OP_BYTES[op[0]];
+      switch (op[0]) {
+        case OP_END:
+          endGesture();
+          moving_.store(false, std::memory_order_release);
+          return;
+        case OP_MOVE:
+          pc_ = next;
+          startSegment(q16FromInt(op[1]), op[2] | (op[3] << 8), ease_);
+          return;
+        case OP_HOLD:
+          pc_ = next;
+          startSegment(pos_.load(std::memory_order_relaxed), op[1] | (op[2] << 8), ease_);
+          return;
+        case OP_EASE:
+          ease_ = (ServoEase)op[1];
+          break;
+        case OP_OSC:
+          pc_ = next;
+          oscCenter_ = pos_.load(std::memory_order_relaxed);
+          oscAmp_ = q16FromInt(op[1]);
+          oscHalfMs_ = op[2] | (op[3] << 8);
+          oscSwings_ = op[4];
+          oscKeep_ = op[5];
+          oscSwing_ = 0;
+          oscSwing();
+          return;
+        case OP_REPEAT:
+          if (!looping_) {
+            repeatLeft_ = op[1];
+            looping_ = true;
+          }
+          if (repeatLeft_) {
+            repeatLeft_--;
+            next = pc_ - op[2];
+          } else {
+            looping_ = false;
+          }
+          break;
+        case OP_SYNC:
+          sync_.store(op[1], std::memory_order_release);
+          break;
+      }
+      pc_ = next;
+    }
+  }
+
+  // Quarter swing out, half swings across (amplitude x keep/256 each),
+  // quarter swing back to the centre
+  void oscSwing() {
+    if (oscSwing_ == oscSwings_) {
+      oscSwings_ = 0;
+      startSegment(oscCenter_, oscHalfMs_ / 2, ease_);
+      return;
+    }
+    if (oscSwing_) oscAmp_ = -(q16_t)(((int64_t)oscAmp_ * oscKeep_) >> 8);
+    startSegment(oscCenter_ + oscAmp_, oscSwing_ ? oscHalfMs_ : oscHalfMs_ / 2, ease_);
+    oscSwing_++;
+  }
+
+  bool startHeld() {
+    uint32_t until = holdUntilUs_.load(std::memory_order_acquire);
+    if (!until || !request_.load(std::memory_order_acquire)) return false;
+    if ((int32_t)(until - micros()) > 0) {
+      stats_.heldSteps++;
+      return true;
+    }
+    holdUntilUs_.compare_exchange_strong(until, 0);   // expired, unless renewed meanwhile
+    return false;
+  }
+
+  static q16_t ease(ServoEase e, q16_t u) {
+    switch (e) {
+      case SERVO_EASE_LINEAR: return u;
+      case SERVO_EASE_SMOOTH: return q16Smoothstep(u);
+      default:          return minJerk(u);
+    }
+  }
+
+  // Rates over the last interval: at rest writes/s drops to 0 while the
+  // planner keeps stepping
+  void report(unsigned long now) {
+    const ServoStats st = stats_;              // counted on the timer task
+    const uint32_t ms = now - lastStatsMs_;
+    const uint32_t steps = st.steps - reported_.steps, writes = st.writes - reported_.writes;
+    Serial.printf("[SERVO] writes=%lu/s steps=%lu/s (%lu%% written) segments=%lu gestures=%lu held steps=%lu\n",
+                  (unsigned long)(writes * 1000ULL / ms), (unsigned long)(steps * 1000ULL / ms),
+                  (unsigned long)(steps ? writes * 100ULL / steps : 0),
+                  (unsigned long)(st.segments - reported_.segments), (unsigned long)(st.gestures - reported_.gestures),
+                  (unsigned long)(st.heldSteps - reported_.heldSteps));
+    reported_ = st;
+    lastStatsMs_ = now;
+  }
+
+  // 10u^3 - 15u^4 + 6u^5 = u^3 (10 + u (6u - 15))
+  static q16_t minJerk(q16_t u) {
+    const q16_t u3 = q16Mul(q16Mul(u, u), u);
+    return q16Mul(u3, 10 * Q16_ONE + q16Mul(u, 6 * u - 15 * Q16_ONE));
+  }
+
+  void writePulse(q16_t pos) {
+    const int pulse = MIN_US + ((q16Mul(pos, US_PER_DEG) + Q16_HALF) >> 16);
+    if (pulse == lastPulse_) return;
+    lastPulse_ = pulse;
+    servo_.writeMicroseconds(pulse);
+    stats_.writes++;
+  }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,209 @@
+#ifndef SERVO_GESTURES_H
+#define SERVO_GESTURES_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// SERVO GESTURES - Head motions as bytecode (flash table + websocket upload)
+// ============================================================================
+// A gesture is a short program for the servo planner. ServoController runs
+// it from its planner step, at most GESTURE_OPS_PER_STEP ops per step, so a
+// gesture costs the same per step as a plain move whatever it contains.
+//
+//   OP_MOVE    deg, ms(u16)       move to deg over ms
+//   OP_HOLD    ms(u16)            stay put
+//   OP_EASE    ServoEase          profile for the moves that follow
+//   OP_OSC     amp, half(u16), n, keep
+//                                 n half-swings of amp deg around the
+//                                 current angle, half ms each, amp scaled
+//                                 by keep/256 per swing; ends centred
+//   OP_REPEAT  count, back        jump back 'back' bytes, count more times
+//                                 (one level, no nesting)
+//   OP_SYNC    marker             report marker to the loop (takeSync())
+//   OP_END
+//
+// Uploaded blobs are 'G', version, then the code. validGesture() walks the
+// program like the planner would, so a gesture that leaves the 60-120°
+// cardboard range anywhere, never ends, or jumps into the middle of an op
+// is rejected before it reaches the servo.
+
+enum GestureOp : uint8_t {
+  OP_END,
+  OP_MOVE,
+  OP_HOLD,
+  OP_EASE,
+  OP_OSC,
+  OP_REPEAT,
+  OP_SYNC,
+  OP_COUNT
+};
+
+enum ServoEase : uint8_t {
+  SERVO_EASE_MIN_JERK,
+  SERVO_EASE_LINEAR,
+  SERVO_EASE_SMOOTH
+};
+
+enum GestureId : uint8_t {
+  GESTURE_SHAKE,
+  GESTURE_NOD,          // cardboard body: a slow, small shake
+  GESTURE_TILT,
+  GESTURE_WIGGLE,
+  GESTURE_COUNT,
+  GESTURE_UPLOADED = GESTURE_COUNT
+};
+
+static const uint8_t GESTURE_MAGIC = 'G';
+static const uint8_t GESTURE_VERSION = 1;
+static const uint8_t GESTURE_HEADER_BYTES = 2;
+static const uint8_t GESTURE_MIN_DEG = 60;
+static const uint8_t GESTURE_MAX_DEG = 120;
+
+// Bytes per op, OP_END first
+static constexpr uint8_t GESTURE_OP_BYTES[] = { 1, 4, 3, 2, 6, 3, 2 };
+static_assert(sizeof(GESTURE_OP_BYTES) == OP_COUNT, "GESTURE_OP_BYTES[] needs one entry per GestureOp");
+
+#define G_U16(v)                       (uint8_t)((v) & 0xFF), (uint8_t)(((v) >> 8) & 0xFF)
+#define G_MOVE(deg, ms)                OP_MOVE, deg, G_U16(ms)
+#define G_HOLD(ms)                     OP_HOLD, G_U16(ms)
+#define G_EASE(ease)                   OP_EASE, ease
+#define G_OSC(amp, halfMs, n, keep)    OP_OSC, amp, G_U16(halfMs), n, keep
+#define G_REPEAT(count, back)          OP_REPEAT, count, back
+#define G_SYNC(marker)                 OP_SYNC, marker
+#define G_END                          OP_END
+
+// Side to side, dying out (the old procedural shake)
+static const uint8_t GESTURE_SHAKE_CODE[] = {
+  G_MOVE(90, 150), G_OSC(15, 450, 3, 180), G_END
+};
+
+static const uint8_t GESTURE_NOD_CODE[] = {
+  G_MOVE(90, 200), G_EASE(SERVO_EASE_SMOOTH), G_OSC(8, 600, 2, 160), G_END
+};
+
+static const uint8_t GESTURE_TILT_CODE[] = {
+  G_MOVE(105, 400), G_HOLD(1500), G_MOVE(90, 500), G_END
+};
+
+// Three quick twitches, a sync marker on each
+static const uint8_t GESTURE_WIGGLE_CODE[] = {
+  G_MOVE(90, 150),
+  G_SYNC(1), G_MOVE(97, 120), G_MOVE(83, 160),      // loop body: 10 bytes
+  G_REPEAT(2, 10),
+  G_MOVE(90, 120), G_END
+};
+
+struct Gesture {
+  GestureId id;
+  const char* name;
+  const uint8_t* code;
+  uint8_t len;
+};
+
+static constexpr Gesture GESTURES[] = {
+  { GESTURE_SHAKE,  "shake",  GESTURE_SHAKE_CODE,  sizeof(GESTURE_SHAKE_CODE) },
+  { GESTURE_NOD,    "nod",    GESTURE_NOD_CODE,    sizeof(GESTURE_NOD_CODE) },
+  { GESTURE_TILT,   "tilt",   GESTURE_TILT_CODE,   sizeof(GESTURE_TILT_CODE) },
+  { GESTURE_WIGGLE, "wiggle", GESTURE_WIGGLE_CODE, sizeof(GESTURE_WIGGLE_CODE) },
+};
+
+static_assert(sizeof(GESTURES) / sizeof(GESTURES[0]) == GESTURE_COUNT, "GESTURES[] needs one row per GestureId");
+
+constexpr bool gestureIdsInOrder(int i) {
+  return i == GESTURE_COUNT || (GESTURES[i].id == i && gestureIdsInOrder(i + 1));
+}
+static_assert(gestureIdsInOrder(0), "GESTURES[] rows must be in GestureId order");
+
+// Websocket boundary only; false for unknown names
+inline bool findGesture(const char* name, GestureId& id) {
+  for (uint8_t i = 0; i < GESTURE_COUNT; i++) {
+    if (strcmp(GESTURES[i].name, name) == 0) {
+      id = (GestureId)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Walk code[0..len) the way the planner runs it: every op whole, every
+// angle it can reach inside the cardboard range, a move before the first
+// swing (so the centre is known), REPEAT bodies with a timed op and no
+// REPEAT inside, OP_END last. durationMs: total run time.
+inline bool validGesture(const uint8_t* code, uint8_t len, uint32_t* durationMs = nullptr) {
+  if (len == 0 || len > GESTURE_MAX_BYTES) return false;
+  // Op boundaries first, so jumps can be checked
+  uint8_t starts[GESTURE_MAX_BYTES];
+  uint8_t ops = 0;
+  for (uint8_t pc = 0; pc < len;) {
+    if (code[pc] >= OP_COUNT || pc + GESTURE_OP_BYTES[code[pc]] > len) return false;
+    starts[ops++] = pc;
+    if (code[pc] == OP_END) {
+      if (pc + 1 != len) return false;
+      break;
+    }
+    pc += GESTURE_OP_BYTES[code[pc]];
+  }
+  if (!ops || code[starts[ops - 1]] != OP_END) return false;
+
+  for (uint8_t i = 0; i < ops; i++) {
+    const uint8_t* op = code + starts[i];
+    if (op[0] == OP_EASE && op[1] > SERVO_EASE_SMOOTH) return false;
+    if (op[0] != OP_REPEAT) continue;
+    const uint8_t back = op[2];
+    if (back == 0 || back > starts[i]) return false;
+    bool boundary = false, timed = false;
+    for (uint8_t j = 0; j < i; j++) {
+      if (starts[j] == starts[i] - back) boundary = true;
+      if (starts[j] >= starts[i] - back) {
+        const uint8_t o = code[starts[j]];
+        if (o == OP_REPEAT) return false;
+        if (o == OP_MOVE || o == OP_HOLD || o == OP_OSC) timed = true;
+      }
+    }
+    if (!boundary || !timed) return false;
+  }
+
+  // Run it: angles and time (repeats are finite, so this ends)
+  int16_t pos = -1;
+  uint32_t ms = 0;
+  uint8_t left = 0;
+  bool looping = false;
+  for (uint8_t pc = 0; code[pc] != OP_END;) {
+    const uint8_t* op = code + pc;
+    uint8_t next = pc + GESTURE_OP_BYTES[op[0]];
+    switch (op[0]) {
+      case OP_MOVE:
+        if (op[1] < GESTURE_MIN_DEG || op[1] > GESTURE_MAX_DEG) return false;
+        pos = op[1];
+        ms += op[2] | (op[3] << 8);
+        break;
+      case OP_HOLD:
+        ms += op[1] | (op[2] << 8);
+        break;
+      case OP_OSC:
+        if (pos < 0 || op[4] == 0) return false;
+        if (pos - op[1] < GESTURE_MIN_DEG || pos + op[1] > GESTURE_MAX_DEG) return false;
+        ms += (uint32_t)(op[2] | (op[3] << 8)) * op[4];
+        break;
+      case OP_REPEAT:
+        if (!looping) {
+          left = op[1];
+          looping = true;
+        }
+        if (left) {
+          left--;
+          next = pc - op[2];
+        } else {
+          looping = false;
+        }
+        break;
+    }
+    pc = next;
+  }
+  if (ms > GESTURE_MAX_MS) return false;
+  if (durationMs) *durationMs = ms;
+  return true;
+}
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef STOPWATCH_VIEW_H
+#define STOPWATCH_VIEW_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "config.h"
+
+// ============================================================================
+// STOPWATCH VIEW - Incremental "MM:SS.cc" display
+// ============================================================================
+// Each glyph the stopwatch can show is rasterized once with U8g2 and kept in
+// SH1106 page layout (bit n = pixel row n, like EyeShapeCache), but only the
+// pages its font touches: 5 for the big digits, 2 for the small ones. After the first full frame only the digit cells whose value
+// changed are rewritten in the frame buffer, and the caller pushes just the
+// tile columns returned by update() - normally the centiseconds, i.e. 2 tiles
+// on the digit rows instead of the whole 1 KB screen.
+
+class StopwatchView {
+public:
+  // Draw the whole stopwatch screen into the (already cleared) frame buffer
+  void drawFull(U8G2& d, int minutes, int seconds, int centis) {
+    if (!built_) build(d);
+
+    d.setFont(u8g2_font_6x10_tr);
+    d.setDrawColor(1);
+    d.drawStr(40, 12, "STOPWATCH");
+
+    for (uint8_t i = 0; i < cellCount_; i++) cells_[i].shown = -1;
+    update(d, minutes, seconds, centis);
+  }
+
+  // Rewrite changed cells only; returns the dirty tile columns (bit = tile x)
+  uint16_t update(U8G2& d, int minutes, int seconds, int centis) {
+    int8_t values[MAX_CELLS];
+    values[0] = (minutes / 10) % 10;
+    values[1] = minutes % 10;
+    values[2] = SEPARATOR;
+    values[3] = seconds / 10;
+    values[4] = seconds % 10;
+    values[5] = SEPARATOR;
+    values[6] = centis / 10;
+    values[7] = centis % 10;
+
+    uint8_t* buf = d.getBufferPtr();
+    uint16_t dirty = 0;
+    for (uint8_t i = 0; i < cellCount_; i++) {
+      Cell& c = cells_[i];
+      if (c.shown == values[i]) continue;
+      c.shown = values[i];
+
+      if (c.big) blit(buf, c, big_, values[i]);
+      else blit(buf, c, small_, values[i]);
+      for (uint8_t tx = c.x >> 3; tx <= (c.x + c.w - 1) >> 3; tx++) dirty |= (1u << tx);
+    }
+    return dirty;
+  }
+
+  // Tile rows the digits live on (valid after the first drawFull)
+  uint8_t firstTileRow() const { return firstRow_; }
+  uint8_t lastTileRow() const { return lastRow_; }
+
+private:
+  static const uint8_t MAX_CELLS = 8;      // M M : S S . c c
+  static const uint8_t SEPARATOR = 10;     // glyph index of ':' / '.'
+  static const int BASELINE = 42;
+  static const int CAPTURE_X = 8;
+
+  // The pages of the band (rows any glyph of the font touches) per column.
+  // Glyphs wider or taller than the capacity are clipped.
+  template <uint8_t PAGES, uint8_t W>
+  struct GlyphSet {
+    static const uint8_t MAX_PAGES = PAGES;
+    static const uint8_t MAX_W = W;
+    uint8_t w = 0;                         // digit cell width
+    uint8_t sepW = 0;                      // separator cell width
+    uint8_t page0 = 0;                     // first page of the band
+    uint8_t pages = 0;                     // band height in pages
+    uint8_t band[PAGES] = {};              // band rows, per page
+    uint8_t cols[11][PAGES][W];
+  };
+  typedef GlyphSet<5, 18> BigGlyphs;       // logisoso28: rows 14..41, 18 wide
+  typedef GlyphSet<2, 6> SmallGlyphs;      // 6x10: rows 35..42, 5 wide
+
+  struct Cell {
+    uint8_t x = 0;
+    uint8_t w = 0;
+    bool big = true;
+    int8_t shown = -1;                     // glyph index on screen, -1 = unknown
+  };
+
+  BigGlyphs big_;
+  SmallGlyphs small_;
+  Cell cells_[MAX_CELLS];
+  uint8_t cellCount_ = 0;
+  uint8_t firstRow_ = 0;
+  uint8_t lastRow_ = 7;
+  bool built_ = false;
+
+  template <class G>
+  static void blit(uint8_t* buf, const Cell& c, const G& g, uint8_t glyph) {
+    for (uint8_t p = 0; p < g.pages; p++) {
+      uint8_t* row = buf + (g.page0 + p) * 128 + c.x;
+      const uint8_t m = g.band[p];
+      for (uint8_t x = 0; x < c.w; x++) row[x] = (row[x] & ~m) | g.cols[glyph][p][x];
+    }
+  }
+
+  template <class G>
+  static void capture(U8G2& d, const uint8_t* font, char sep, G& g) {
+    static const char DIGITS[] = "0123456789";
+    d.setFont(font);
+    d.setFontMode(1);
+    d.setDrawColor(1);
+    char str[2] = {0, 0};
+    g.w = 0;
+    for (uint8_t i = 0; i < 10; i++) {
+      str[0] = DIGITS[i];
+      uint8_t w = d.getStrWidth(str);
+      if (w > g.w) g.w = w;
+    }
+    str[0] = sep;
+    g.sepW = d.getStrWidth(str);
+    if (g.w > G::MAX_W) g.w = G::MAX_W;
+    if (g.sepW > G::MAX_W) g.sepW = G::MAX_W;
+
+    // Two passes: find the band over all glyphs, then keep only its pages
+    const uint8_t* buf = d.getBufferPtr();
+    uint8_t band[8] = {};
+    for (uint8_t pass = 0; pass < 2; pass++) {
+      for (uint8_t i = 0; i <= SEPARATOR; i++) {
+        str[0] = (i == SEPARATOR) ? sep : DIGITS[i];
+        d.clearBuffer();
+        d.drawStr(CAPTURE_X, BASELINE, str);
+        for (uint8_t x = 0; x < G::MAX_W; x++) {
+          if (pass == 0) {
+            for (uint8_t p = 0; p < 8; p++) band[p] |= buf[p * 128 + CAPTURE_X + x];
+          } else {
+            for (uint8_t p = 0; p < g.pages; p++) g.cols[i][p][x] = buf[(g.page0 + p) * 128 + CAPTURE_X + x];
+          }
+        }
+      }
+      if (pass == 0) {
+        uint8_t first = 8, last = 0;
+        for (uint8_t p = 0; p < 8; p++) {
+          if (band[p]) {
+            if (p < first) first = p;
+            last = p;
+          }
+        }
+        g.page0 = (first < 8) ? first : 0;
+        g.pages = (first < 8) ? last - first + 1 : 0;
+        if (g.pages > G::MAX_PAGES) g.pages = G::MAX_PAGES;
+        for (uint8_t p = 0; p < g.pages; p++) g.band[p] = band[g.page0 + p];
+      }
+    }
+  }
+
+  void build(U8G2& d) {
+    capture(d, u8g2_font_logisoso28_tn, ':', big_);
+    capture(d, u8g2_font_6x10_tr, '.', small_);
+    d.clearBuffer();
+
+    // Fixed layout: digits get the widest digit's cell so nothing shifts
+    // while counting. "MM:SS" centred, ".cc" right after it like before.
+    const uint8_t bigW = 4 * big_.w + big_.sepW;
+    uint8_t x = (128 - bigW) / 2;
+    cellCount_ = 0;
+    for (uint8_t i = 0; i < 5; i++) {
+      Cell& c = cells_[cellCount_++];
+      c.big = true;
+      c.w = (i == 2) ? big_.sepW : big_.w;
+      c.x = x;
+      x += c.w;
+    }
+    x += 2;
+    for (uint8_t i = 0; i < 1 + STOPWATCH_PRECISION && STOPWATCH_PRECISION > 0; i++) {
+      Cell& c = cells_[cellCount_++];
+      c.big = false;
+      c.w = (i == 0) ? small_.sepW : small_.w;
+      if (x + c.w > 128) c.w = 128 - x;
+      c.x = x;
+      x += c.w;
+    }
+
+    firstRow_ = 7;
+    lastRow_ = 0;
+    if (big_.pages) {
+      firstRow_ = big_.page0;
+      lastRow_ = big_.page0 + big_.pages - 1;
+    }
+    if (small_.pages) {
+      firstRow_ = min<uint8_t>(firstRow_, small_.page0);
+      lastRow_ = max<uint8_t>(lastRow_, small_.page0 + small_.pages - 1);
+    }
+    built_ = true;
+  }
+};
+
+#endif
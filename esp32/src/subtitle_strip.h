@@ -0,0 +1,73 @@
+#ifndef SUBTITLE_STRIP_H
+#define SUBTITLE_STRIP_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "config.h"
+
+// ============================================================================
+// SUBTITLE STRIP - Spoken text as a marquee on the bottom page row
+// ============================================================================
+// The text is rasterized once, glyph by glyph, into one long run of column
+// masks in SH1106 page layout (bit n = pixel row 56 + n). Every frame after
+// that is a 128-byte window copy into page 7 at the current scroll column,
+// the same cost for a three-word reply as for a paragraph, and only the
+// bottom tile row changes for the TileFlusher / page hashes.
+//
+// The font is monospaced, so the strip width (and with it the scroll range)
+// is known from the text length alone; the main loop computes the scroll
+// column without touching the strip, which lives on the render side.
+
+class SubtitleStrip {
+public:
+  static const uint8_t PAGE = 7;            // rows 56..63
+  static const uint8_t CELL_W = 5;          // u8g2_font_5x7_tr advance
+  static const uint16_t MAX_COLS = SUBTITLE_MAX_CHARS * CELL_W;
+
+  static uint16_t widthOf(uint8_t len) { return (uint16_t)len * CELL_W; }
+
+  // Rasterize text (at most SUBTITLE_MAX_CHARS) unless it is already the
+  // strip's content. Draws into the display buffer, so call it before the
+  // frame is drawn; on a page buffer it leaves the current page at PAGE.
+  void build(U8G2& d, uint16_t id, const char* text) {
+    if (id == id_) return;
+    const uint8_t tileH = d.getBufferTileHeight();
+    const uint8_t row = 8 - tileH;           // full buffer: 0, page buffer: 7
+    if (tileH < 8) d.setBufferCurrTileRow(row);
+    uint8_t* page = d.getBufferPtr() + (PAGE - row) * 128;
+
+    d.setFont(u8g2_font_5x7_tr);
+    d.setFontMode(1);
+    d.setDrawColor(1);
+    width_ = 0;
+    for (uint8_t i = 0; text[i] && i < SUBTITLE_MAX_CHARS; i++) {
+      memset(page, 0, CAPTURE_X + CELL_W);
+      d.drawGlyph(CAPTURE_X, BASELINE, (uint8_t)text[i]);
+      memcpy(cols_ + width_, page + CAPTURE_X, CELL_W);
+      width_ += CELL_W;
+    }
+    memset(page, 0, 128);
+    id_ = id;
+  }
+
+  // Copy the 128 columns starting at strip column x0 (may be negative, or
+  // run past the end: blank there) over page 7 of a page-layout buffer
+  void blit(uint8_t* page, int16_t x0) const {
+    for (int16_t x = 0; x < 128; x++) {
+      int16_t c = x0 + x;
+      page[x] = (c >= 0 && c < (int16_t)width_) ? cols_[c] : 0;
+    }
+  }
+
+  uint16_t width() const { return width_; }
+
+private:
+  static const uint8_t CAPTURE_X = 8;
+  static const uint8_t BASELINE = 62;       // one row left for descenders
+
+  uint8_t cols_[MAX_COLS];
+  uint16_t width_ = 0;
+  uint16_t id_ = 0;                         // 0 = nothing built yet
+};
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef TILE_FLUSH_H
+#define TILE_FLUSH_H
+
+#include <U8g2lib.h>
+
+// ============================================================================
+// TILE FLUSH - Sends only the 8x8 tiles that changed since the last frame
+// ============================================================================
+// The SH1106 full buffer is 8 tile rows x 16 tile columns, each tile being
+// 8 vertical bytes. We keep a shadow copy of what the panel currently shows,
+// diff the fresh frame against it tile by tile and push only dirty runs with
+// updateDisplayArea(). A mostly static face costs a few dozen bytes of I2C
+// instead of the whole 1 KB frame.
+
+struct FlushStats {
+  uint32_t frames = 0;        // flush() calls
+  uint32_t fullFrames = 0;    // full sendBuffer() (first frame / invalidated)
+  uint32_t bytesSent = 0;     // tile payload bytes pushed over I2C
+  uint32_t tilesSent = 0;
+  uint32_t tilesSkipped = 0;  // clean tiles we did not resend
+  uint32_t areaCalls = 0;     // updateDisplayArea() transactions
+};
+
+class TileFlusher {
+public:
+  static const uint8_t TILES_X = 16;
+  static const uint8_t TILES_Y = 8;
+  static const uint16_t FRAME_BYTES = TILES_X * TILES_Y * 8;
+
+  explicit TileFlusher(U8G2& display) : display_(display) {}
+
+  // Force the next flush to resend the whole frame (panel content unknown)
+  void invalidate() { shadowValid_ = false; }
+
+  void flush() {
+    uint8_t* buf = display_.getBufferPtr();
+    stats_.frames++;
+
+    if (!shadowValid_) {
+      display_.sendBuffer();
+      memcpy(shadow_, buf, FRAME_BYTES);
+      shadowValid_ = true;
+      stats_.fullFrames++;
+      stats_.bytesSent += FRAME_BYTES;
+      stats_.tilesSent += TILES_X * TILES_Y;
+      return;
+    }
+
+    for (uint8_t ty = 0; ty < TILES_Y; ty++) {
+      sendRow(ty, mergeRuns(diffRow(buf, ty, 0xFFFF)));
+    }
+  }
+
+  // Like flush(), but only looks at the tile columns in colMask on tile rows
+  // ty0..ty1. For callers that know exactly what they redrew (the
+  // stopwatch digits); tiles outside the window must be unchanged.
+  void flushTiles(uint16_t colMask, uint8_t ty0, uint8_t ty1) {
+    if (!shadowValid_) {
+      flush();
+      return;
+    }
+    uint8_t* buf = display_.getBufferPtr();
+    stats_.frames++;
+    for (uint8_t ty = ty0; ty <= ty1 && ty < TILES_Y; ty++) {
+      sendRow(ty, mergeRuns(diffRow(buf, ty, colMask)));
+    }
+    stats_.tilesSkipped += (TILES_Y - (ty1 - ty0 + 1)) * TILES_X;
+  }
+
+  const FlushStats& stats() const { return stats_; }
+  const uint8_t* shadow() const { return shadow_; }
+
+private:
+  U8G2& display_;
+  uint8_t shadow_[FRAME_BYTES];
+  bool shadowValid_ = false;
+  FlushStats stats_;
+
+  // Send the tiles set in `send` on row ty, one updateDisplayArea per run
+  void sendRow(uint8_t ty, uint16_t send) {
+    stats_.tilesSkipped += TILES_X - countBits(send);
+
+    uint8_t tx = 0;
+    while (send) {
+      if (!(send & 1u)) { send >>= 1; tx++; continue; }
+      uint8_t run = 0;
+      while (send & 1u) { send >>= 1; run++; }
+      display_.updateDisplayArea(tx, ty, run, 1);
+      stats_.areaCalls++;
+      stats_.tilesSent += run;
+      stats_.bytesSent += run * 8;
+      tx += run;
+    }
+  }
+
+  // Compare the tiles in colMask of one tile row against the shadow, refresh
+  // the shadow and return a bitmask of dirty tile columns.
+  uint16_t diffRow(const uint8_t* buf, uint8_t ty, uint16_t colMask) {
+    uint16_t dirty = 0;
+    const uint16_t rowOffset = ty * TILES_X * 8;
+    for (uint8_t tx = 0; tx < TILES_X; tx++) {
+      if (!(colMask & (1u << tx))) continue;
+      const uint16_t o = rowOffset + tx * 8;
+      uint32_t a[2], b[2];
+      memcpy(a, buf + o, 8);
+      memcpy(b, shadow_ + o, 8);
+      if (a[0] != b[0] || a[1] != b[1]) {
+        memcpy(shadow_ + o, buf + o, 8);
+        dirty |= (1u << tx);
+      }
+    }
+    return dirty;
+  }
+
+  // A single clean tile between two dirty ones is sent along with them:
+  // resending 8 clean bytes is cheaper than a new page/column address setup.
+  static uint16_t mergeRuns(uint16_t dirty) {
+    return dirty | ((dirty >> 1) & (dirty << 1));
+  }
+
+  static uint8_t countBits(uint16_t v) {
+    uint8_t n = 0;
+    while (v) { v &= v - 1; n++; }
+    return n;
+  }
+};
+
+#endif
@@ -0,0 +1,326 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "pins.h"
+#include "fixed_math.h"
+#include "behaviors.h"
+#include "eye_engine.h"
+#include "led_controller.h"
+#include "servo_controller.h"
+
+// ============================================================================
+// TIMELINE - Behaviors as keyframe tracks on one clock
+// ============================================================================
+// A behavior's choreography is a compact blob of tracks: eye expression, eye
+// parameters, LED mood, servo angle and buzzer notes. tick() samples every
+// active track from the same time base (the AnimClock tick), so the head
+// shake, the chirp and the ring change stay in step however busy the loop is.
+//
+// Blob layout, little endian (flash: timelines.h; RAM: load() from the
+// websocket):
+//
+//   header  [0] 'T'  [1] version  [2] BehaviorId (TIMELINE_UNBOUND = none)
+//           [3] track count  [4..5] length ms  [6..7] reserved
+//   track   [0] TimelineTrackKind  [1] channel  [2] key count  [3] TimelineKeyMode
+//   key     [0..1] time ms  [2..3] value (int16)
+//
+// Key values: TRACK_EXPRESSION a BehaviorId, TRACK_LED a LedMoodId,
+// TRACK_SERVO degrees, TRACK_NOTE Hz (0 = rest), TRACK_EYE Q8.8 of the
+// EyeParams field picked by channel (px, or 0..1 for lids and blink),
+// TRACK_GESTURE a GestureId (servo_gestures.h). Interpolated servo tracks
+// are minimum-jerk between keys, whatever the key mode, and start from
+// wherever the head is at their first key. Servo and gesture tracks drive
+// the same output, so one replaces the other.
+//
+// Starting a timeline only takes over the outputs it has tracks for; a
+// melody keeps playing under a timeline without a note track. The player
+// walks a small list of active track cursors that each remember their next
+// key, so a tick costs a compare per active track plus the keys it crosses,
+// however many behaviors there are. A track leaves the list after its last
+// key and the timeline's length. A track that finds the list full is
+// dropped with a log line; the counters go to Serial every
+// TIMELINE_STATS_MS.
+
+enum TimelineTrackKind : uint8_t {
+  TRACK_EXPRESSION,
+  TRACK_EYE,
+  TRACK_LED,
+  TRACK_SERVO,
+  TRACK_NOTE,
+  TRACK_GESTURE,
+  TRACK_KIND_COUNT
+};
+
+static const char* const TRACK_KIND_NAMES[TRACK_KIND_COUNT] = {
+  "expression", "eye", "led", "servo", "note", "gesture"
+};
+
+enum TimelineKeyMode : uint8_t {
+  KEY_STEP,            // value holds until the next key
+  KEY_LINEAR,
+  KEY_SMOOTH           // smoothstep between keys
+};
+
+static const uint8_t TIMELINE_MAGIC = 'T';
+static const uint8_t TIMELINE_VERSION = 1;
+static const uint8_t TIMELINE_UNBOUND = 0xFF;
+static const uint8_t TIMELINE_HEADER_BYTES = 8;
+static const uint8_t TIMELINE_TRACK_BYTES = 4;
+static const uint8_t TIMELINE_KEY_BYTES = 4;
+
+// Blob building blocks for timelines.h
+#define TL_U16(v)                      (uint8_t)((v) & 0xFF), (uint8_t)(((v) >> 8) & 0xFF)
+#define TL_HEADER(beh, tracks, lenMs)  TIMELINE_MAGIC, TIMELINE_VERSION, (uint8_t)(beh), tracks, TL_U16(lenMs), 0, 0
+#define TL_TRACK(kind, ch, keys, mode) kind, ch, keys, mode
+#define TL_KEY(ms, value)              TL_U16(ms), TL_U16((uint16_t)(int16_t)(value))
+
+struct TimelineStats {
+  uint32_t plays = 0;
+  uint32_t keys = 0;             // keys crossed
+  uint32_t loads = 0;            // blobs accepted from the websocket
+  uint32_t rejected = 0;         // blobs that failed validation
+  uint32_t dropped = 0;          // tracks that found no free cursor
+  uint8_t activeMax = 0;
+};
+
+class TimelinePlayer {
+public:
+  void attach(EyeEngine* eye, LedController* leds, ServoController* servo) {
+    eye_ = eye;
+    leds_ = leds;
+    servo_ = servo;
+  }
+
+  // Start a (validated) blob on the shared clock; its t = 0 keys apply now
+  void play(const uint8_t* blob) {
+    if (!blob) return;
+    const uint16_t lengthMs = u16(blob + 4);
+    const uint8_t* p = blob + TIMELINE_HEADER_BYTES;
+    for (uint8_t t = 0; t < blob[3]; t++) {
+      const uint8_t kind = p[0], channel = p[1], count = p[2];
+      evict(kind, channel);
+      if (active_ < TIMELINE_MAX_TRACKS) {
+        TrackCursor& c = cursors_[active_++];
+        c.keys = p + TIMELINE_TRACK_BYTES;
+        c.originUs = nowUs_;
+        c.endMs = max<uint16_t>(lengthMs, keyTime(c.keys, count - 1));
+        c.kind = kind;
+        c.channel = channel;
+        c.count = count;
+        c.mode = p[3];
+        c.next = 0;
+        if (!step(c)) remove(active_ - 1);
+      } else {
+        stats_.dropped++;
+        Serial.printf("[TIMELINE] No free track (%d playing): %s track of %s dropped\n", TIMELINE_MAX_TRACKS,
+                      TRACK_KIND_NAMES[kind], blob[2] < BEH_COUNT ? BEHAVIORS[blob[2]].name : "preview");
+      }
+      p += TIMELINE_TRACK_BYTES + count * TIMELINE_KEY_BYTES;
+    }
+    if (active_ > stats_.activeMax) stats_.activeMax = active_;
+    stats_.plays++;
+  }
+
+  // Timeline for a behavior: the uploaded one if it is bound to it
+  const uint8_t* forBehavior(BehaviorId id, const uint8_t* builtIn) const {
+    return (ramLen_ && ram_[2] == id) ? ram_ : builtIn;
+  }
+
+  // Websocket upload: validated, kept in RAM (replacing the previous
+  // upload) and returned for playing, or nullptr
+  const uint8_t* load(const uint8_t* blob, uint16_t len) {
+    if (len > TIMELINE_MAX_BYTES || !valid(blob, len)) {
+      stats_.rejected++;
+      Serial.printf("[TIMELINE] Rejected %u byte upload\n", len);
+      return nullptr;
+    }
+    stopAll();                                  // cursors may point into ram_
+    memcpy(ram_, blob, len);
+    ramLen_ = len;
+    stats_.loads++;
+    Serial.printf("[TIMELINE] Loaded %u bytes, %d tracks, %u ms, for %s\n", len, ram_[3],
+                  u16(ram_ + 4), ram_[2] < BEH_COUNT ? BEHAVIORS[ram_[2]].name : "preview");
+    return ram_;
+  }
+
+  // Something else takes over an output (web servo / LED commands)
+  void stop(TimelineTrackKind kind) {
+    for (uint8_t i = active_; i-- > 0;) {
+      if (outputOf(cursors_[i].kind) == outputOf(kind)) remove(i);
+    }
+    if (kind == TRACK_EYE) applyEye();
+  }
+
+  void stopAll() {
+    while (active_) remove(active_ - 1);
+    applyEye();
+  }
+
+  // One fixed tick of the shared clock
+  void tick(uint32_t dtUs) {
+    nowUs_ += dtUs;
+    if (millis() - lastStatsMs_ > TIMELINE_STATS_MS) {
+      lastStatsMs_ = millis();
+      Serial.printf("[TIMELINE] plays=%lu keys=%lu loads=%lu rejected=%lu dropped=%lu active max=%u/%d\n",
+                    (unsigned long)stats_.plays, (unsigned long)stats_.keys, (unsigned long)stats_.loads,
+                    (unsigned long)stats_.rejected, (unsigned long)stats_.dropped,
+                    stats_.activeMax, TIMELINE_MAX_TRACKS);
+    }
+    if (!active_ && !eyeDriven_) return;
+    for (uint8_t i = active_; i-- > 0;) {
+      if (!step(cursors_[i])) remove(i);
+    }
+    applyEye();
+  }
+
+  uint8_t active() const { return active_; }
+  const TimelineStats& stats() const { return stats_; }
+
+  // Structure and value ranges, before anything reads a blob
+  static bool valid(const uint8_t* b, uint16_t len) {
+    if (len < TIMELINE_HEADER_BYTES || b[0] != TIMELINE_MAGIC || b[1] != TIMELINE_VERSION) return false;
+    if (b[2] >= BEH_COUNT && b[2] != TIMELINE_UNBOUND) return false;
+    uint16_t o = TIMELINE_HEADER_BYTES;
+    for (uint8_t t = 0; t < b[3]; t++) {
+      if (o + TIMELINE_TRACK_BYTES > len) return false;
+      const uint8_t kind = b[o], channel = b[o + 1], count = b[o + 2], mode = b[o + 3];
+      if (kind >= TRACK_KIND_COUNT || mode > KEY_SMOOTH || count == 0) return false;
+      if (kind == TRACK_EYE && channel >= EYE_PARAM_COUNT) return false;
+      o += TIMELINE_TRACK_BYTES;
+      if (o + count * TIMELINE_KEY_BYTES > len) return false;
+      for (uint8_t k = 0; k < count; k++) {
+        const uint8_t* key = b + o + k * TIMELINE_KEY_BYTES;
+        const int16_t v = (int16_t)u16(key + 2);
+        if (k && u16(key) < u16(key - TIMELINE_KEY_BYTES)) return false;
+        if (kind == TRACK_EXPRESSION && (v < 0 || v >= BEH_COUNT)) return false;
+        if (kind == TRACK_LED && (v < 0 || v >= MOOD_COUNT)) return false;
+        if (kind == TRACK_NOTE && v < 0) return false;
+        if (kind == TRACK_GESTURE && (v < 0 || v > GESTURE_UPLOADED)) return false;
+      }
+      o += count * TIMELINE_KEY_BYTES;
+    }
+    return o == len;
+  }
+
+private:
+  struct TrackCursor {
+    const uint8_t* keys;
+    uint32_t originUs;         // shared clock when the timeline started
+    uint16_t endMs;
+    uint8_t kind;
+    uint8_t channel;
+    uint8_t count;
+    uint8_t mode;
+    uint8_t next;              // first key not yet reached
+  };
+
+  EyeEngine* eye_ = nullptr;
+  LedController* leds_ = nullptr;
+  ServoController* servo_ = nullptr;
+
+  TrackCursor cursors_[TIMELINE_MAX_TRACKS];
+  uint8_t active_ = 0;
+  uint32_t nowUs_ = 0;
+
+  EyeParams eyeValue_;
+  uint16_t eyeFields_ = 0;
+  bool eyeDriven_ = false;
+
+  uint8_t ram_[TIMELINE_MAX_BYTES];
+  uint16_t ramLen_ = 0;
+  TimelineStats stats_;
+  unsigned long lastStatsMs_ = 0;
+
+  static uint16_t u16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+  static uint16_t keyTime(const uint8_t* keys, uint8_t k) { return u16(keys + k * TIMELINE_KEY_BYTES); }
+  static int16_t keyValue(const uint8_t* keys, uint8_t k) { return (int16_t)u16(keys + k * TIMELINE_KEY_BYTES + 2); }
+
+  // Sample one track at the current time; false once it is finished
+  bool step(TrackCursor& c) {
+    const uint32_t tMs = (nowUs_ - c.originUs) / 1000;
+    const uint8_t from = c.next;
+    while (c.next < c.count && keyTime(c.keys, c.next) <= tMs) c.next++;
+    stats_.keys += c.next - from;
+
+    if (c.kind == TRACK_SERVO) {
+      if (c.next != from) servoSegment(c, tMs);
+    } else if (c.mode == KEY_STEP || c.next == 0 || c.next == c.count) {
+      // Events fire once, for the last key crossed; eye fields are written
+      // every tick for as long as the track holds them
+      if (c.next && (c.next != from || c.kind == TRACK_EYE)) output(c, q16FromInt(keyValue(c.keys, c.next - 1)));
+    } else {
+      const uint16_t t0 = keyTime(c.keys, c.next - 1), t1 = keyTime(c.keys, c.next);
+      q16_t u = (q16_t)(((uint32_t)(tMs - t0) << 16) / (t1 - t0));
+      if (c.mode == KEY_SMOOTH) u = q16Smoothstep(u);
+      output(c, q16Lerp(q16FromInt(keyValue(c.keys, c.next - 1)), q16FromInt(keyValue(c.keys, c.next)), u));
+    }
+    return c.next < c.count || tMs < c.endMs;
+  }
+
+  // value: the key value as Q16 (interpolated tracks carry a fraction)
+  void output(const TrackCursor& c, q16_t value) {
+    const int16_t v = (int16_t)(value >> 16);
+    switch (c.kind) {
+      case TRACK_EXPRESSION:
+        if (eye_) eye_->setTarget((BehaviorId)v);
+        break;
+      case TRACK_EYE:
+        reinterpret_cast<q16_t*>(&eyeValue_)[c.channel] = value >> 8;   // Q8.8 key -> Q16.16
+        eyeFields_ |= 1u << c.channel;
+        break;
+      case TRACK_LED:
+        if (leds_) leds_->setMood((LedMoodId)v);
+        break;
+      case TRACK_NOTE:
+        if (v > 0) tone(PIN_BUZZER, v);
+        else noTone(PIN_BUZZER);
+        break;
+      case TRACK_GESTURE:
+        if (servo_) servo_->playGesture((GestureId)v);
+        break;
+    }
+  }
+
+  // The servo plans its own motion, so it gets whole segments as keys are
+  // reached: a step key is a move at the planner's speed, an interpolated
+  // gap is one minimum-jerk move that lands on the next key at its time
+  void servoSegment(const TrackCursor& c, uint32_t tMs) {
+    if (!servo_) return;
+    if (c.mode == KEY_STEP || c.next == c.count) {
+      servo_->moveTo(keyValue(c.keys, c.next - 1), 0);
+    } else {
+      servo_->moveTo(keyValue(c.keys, c.next), keyTime(c.keys, c.next) - tMs);
+    }
+  }
+
+  // Eye tracks write the override layer for as long as any of them runs
+  void applyEye() {
+    if (!eye_) return;
+    if (eyeFields_) {
+      eye_->setOverride(eyeValue_, eyeFields_, Q16_ONE);
+      eyeDriven_ = true;
+    } else if (eyeDriven_) {
+      eye_->clearOverride();
+      eyeDriven_ = false;
+    }
+    eyeFields_ = 0;
+  }
+
+  // A new track for the same output replaces the running one
+  void evict(uint8_t kind, uint8_t channel) {
+    for (uint8_t i = active_; i-- > 0;) {
+      if (outputOf(cursors_[i].kind) == outputOf(kind) && (kind != TRACK_EYE || cursors_[i].channel == channel)) remove(i);
+    }
+  }
+
+  static uint8_t outputOf(uint8_t kind) { return kind == TRACK_GESTURE ? TRACK_SERVO : kind; }
+
+  void remove(uint8_t i) {
+    if (cursors_[i].kind == TRACK_NOTE) noTone(PIN_BUZZER);
+    cursors_[i] = cursors_[--active_];
+  }
+};
+
+#endif
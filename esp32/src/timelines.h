@@ -0,0 +1,171 @@
+#ifndef TIMELINES_H
+#define TIMELINES_H
+
+#include <Arduino.h>
+#include "behaviors.h"
+#include "led_moods.h"
+#include "timeline.h"
+
+// ============================================================================
+// TIMELINES - Built-in choreography, one blob per behavior (flash)
+// ============================================================================
+// Servo hold times match the behavior's entry + hold + exit, after which the
+// head comes back to 90°. Layout and key values: timeline.h.
+
+// --- Shared tracks ---
+#define TL_EYES(beh, mood) \
+  TL_TRACK(TRACK_EXPRESSION, 0, 1, KEY_STEP), TL_KEY(0, beh), \
+  TL_TRACK(TRACK_LED, 0, 1, KEY_STEP), TL_KEY(0, mood)
+
+#define TL_SERVO_HOLD(angle, ms) \
+  TL_TRACK(TRACK_SERVO, 0, 2, KEY_STEP), TL_KEY(0, angle), TL_KEY(ms, 90)
+
+#define TL_SERVO_CENTER \
+  TL_TRACK(TRACK_SERVO, 0, 1, KEY_STEP), TL_KEY(0, 90)
+
+// Side to side, dying out over 1.5 s (cardboard body: no nodding)
+#define TL_SERVO_SHAKE \
+  TL_TRACK(TRACK_GESTURE, 0, 1, KEY_STEP), TL_KEY(0, GESTURE_SHAKE)
+
+#define TL_NOTES_HAPPY \
+  TL_TRACK(TRACK_NOTE, 0, 4, KEY_STEP), TL_KEY(0, 1568), TL_KEY(80, 0), TL_KEY(130, 2093), TL_KEY(230, 0)
+
+#define TL_NOTES_SURPRISED \
+  TL_TRACK(TRACK_NOTE, 0, 3, KEY_STEP), TL_KEY(0, 2000), TL_KEY(50, 2500), TL_KEY(100, 0)
+
+// --- Behaviors ---
+static const uint8_t TL_CALM_IDLE[] = {
+  TL_HEADER(BEH_CALM_IDLE, 3, 1000), TL_EYES(BEH_CALM_IDLE, MOOD_IDLE), TL_SERVO_CENTER
+};
+
+static const uint8_t TL_SLEEPY_IDLE[] = {
+  TL_HEADER(BEH_SLEEPY_IDLE, 4, 2400), TL_EYES(BEH_SLEEPY_IDLE, MOOD_SLEEPY),
+  TL_SERVO_HOLD(100, 2400),
+  TL_TRACK(TRACK_NOTE, 0, 3, KEY_STEP), TL_KEY(0, 300), TL_KEY(300, 200), TL_KEY(700, 0)
+};
+
+static const uint8_t TL_HAPPY[] = {
+  TL_HEADER(BEH_HAPPY, 4, 5900), TL_EYES(BEH_HAPPY, MOOD_HAPPY), TL_SERVO_SHAKE, TL_NOTES_HAPPY
+};
+
+static const uint8_t TL_SHY_HAPPY[] = {
+  TL_HEADER(BEH_SHY_HAPPY, 4, 6000), TL_EYES(BEH_SHY_HAPPY, MOOD_HAPPY), TL_SERVO_SHAKE, TL_NOTES_HAPPY
+};
+
+static const uint8_t TL_SAD[] = {
+  TL_HEADER(BEH_SAD, 4, 9600), TL_EYES(BEH_SAD, MOOD_SAD),
+  TL_SERVO_HOLD(70, 9600),
+  TL_TRACK(TRACK_NOTE, 0, 4, KEY_STEP), TL_KEY(0, 440), TL_KEY(200, 392), TL_KEY(500, 349), TL_KEY(900, 0)
+};
+
+static const uint8_t TL_ANGRY[] = {
+  TL_HEADER(BEH_ANGRY, 2, 4800), TL_EYES(BEH_ANGRY, MOOD_ANGRY)
+};
+
+static const uint8_t TL_SURPRISED[] = {
+  TL_HEADER(BEH_SURPRISED, 4, 2050), TL_EYES(BEH_SURPRISED, MOOD_SURPRISED),
+  TL_SERVO_HOLD(75, 2050), TL_NOTES_SURPRISED
+};
+
+static const uint8_t TL_CONFUSED[] = {
+  TL_HEADER(BEH_CONFUSED, 3, 4000), TL_EYES(BEH_CONFUSED, MOOD_SLEEPY), TL_SERVO_HOLD(105, 4000)
+};
+
+static const uint8_t TL_CURIOUS_IDLE[] = {
+  TL_HEADER(BEH_CURIOUS_IDLE, 4, 4800), TL_EYES(BEH_CURIOUS_IDLE, MOOD_CURIOUS),
+  TL_SERVO_HOLD(105, 4800),
+  TL_TRACK(TRACK_NOTE, 0, 4, KEY_STEP), TL_KEY(0, 523), TL_KEY(100, 659), TL_KEY(200, 784), TL_KEY(350, 0)
+};
+
+static const uint8_t TL_LISTENING[] = {
+  TL_HEADER(BEH_LISTENING, 3, 600), TL_EYES(BEH_LISTENING, MOOD_LISTENING), TL_SERVO_CENTER
+};
+
+static const uint8_t TL_THINKING[] = {
+  TL_HEADER(BEH_THINKING, 3, 800), TL_EYES(BEH_THINKING, MOOD_THINKING), TL_SERVO_HOLD(95, 800)
+};
+
+static const uint8_t TL_SPEAKING[] = {
+  TL_HEADER(BEH_SPEAKING, 2, 400), TL_EYES(BEH_SPEAKING, MOOD_SPEAKING)
+};
+
+static const uint8_t TL_SLEEPING[] = {
+  TL_HEADER(BEH_SLEEPING, 2, 5000), TL_EYES(BEH_SLEEPING, MOOD_SLEEPY)
+};
+
+static const uint8_t TL_STARTLED[] = {
+  TL_HEADER(BEH_STARTLED, 4, 1900), TL_EYES(BEH_STARTLED, MOOD_SURPRISED),
+  TL_SERVO_HOLD(75, 1900), TL_NOTES_SURPRISED
+};
+
+static const uint8_t TL_PLAYFUL_MISCHIEF[] = {
+  TL_HEADER(BEH_PLAYFUL_MISCHIEF, 3, 3700), TL_EYES(BEH_PLAYFUL_MISCHIEF, MOOD_PLAYFUL), TL_SERVO_SHAKE
+};
+
+static const uint8_t TL_WAKE_UP[] = {
+  TL_HEADER(BEH_WAKE_UP, 2, 2700), TL_EYES(BEH_WAKE_UP, MOOD_IDLE)
+};
+
+static const uint8_t TL_RANDOM_MOVEMENT[] = {
+  TL_HEADER(BEH_RANDOM_MOVEMENT, 2, 25500), TL_EYES(BEH_RANDOM_MOVEMENT, MOOD_HAPPY)
+};
+
+// --- Not bound to a behavior ---
+static const uint8_t TL_STARTUP[] = {
+  TL_HEADER(TIMELINE_UNBOUND, 1, 400),
+  TL_TRACK(TRACK_NOTE, 0, 4, KEY_STEP), TL_KEY(0, 880), TL_KEY(100, 1046), TL_KEY(200, 1318), TL_KEY(400, 0)
+};
+
+struct TimelineRef {
+  BehaviorId id;
+  const uint8_t* data;
+  uint16_t len;
+};
+
+#define TL_REF(id, blob) { id, blob, sizeof(blob) }
+
+static constexpr TimelineRef TIMELINES[] = {
+  TL_REF(BEH_CALM_IDLE,        TL_CALM_IDLE),
+  TL_REF(BEH_SLEEPY_IDLE,      TL_SLEEPY_IDLE),
+  TL_REF(BEH_HAPPY,            TL_HAPPY),
+  TL_REF(BEH_SHY_HAPPY,        TL_SHY_HAPPY),
+  TL_REF(BEH_SAD,              TL_SAD),
+  TL_REF(BEH_ANGRY,            TL_ANGRY),
+  TL_REF(BEH_SURPRISED,        TL_SURPRISED),
+  TL_REF(BEH_CONFUSED,         TL_CONFUSED),
+  TL_REF(BEH_CURIOUS_IDLE,     TL_CURIOUS_IDLE),
+  TL_REF(BEH_LISTENING,        TL_LISTENING),
+  TL_REF(BEH_THINKING,         TL_THINKING),
+  TL_REF(BEH_SPEAKING,         TL_SPEAKING),
+  TL_REF(BEH_SLEEPING,         TL_SLEEPING),
+  TL_REF(BEH_STARTLED,         TL_STARTLED),
+  TL_REF(BEH_PLAYFUL_MISCHIEF, TL_PLAYFUL_MISCHIEF),
+  TL_REF(BEH_WAKE_UP,          TL_WAKE_UP),
+  TL_REF(BEH_RANDOM_MOVEMENT,  TL_RANDOM_MOVEMENT),
+};
+
+static_assert(sizeof(TIMELINES) / sizeof(TIMELINES[0]) == BEH_COUNT, "TIMELINES[] needs one blob per BehaviorId");
+
+constexpr bool timelineIdsInOrder(int i) {
+  return i == BEH_COUNT || (TIMELINES[i].id == i && timelineIdsInOrder(i + 1));
+}
+static_assert(timelineIdsInOrder(0), "TIMELINES[] rows must be in BehaviorId order");
+
+inline const uint8_t* builtInTimeline(BehaviorId id) {
+  return TIMELINES[id < BEH_COUNT ? id : BEH_CALM_IDLE].data;
+}
+
+// Boot-time check that every blob above is well formed and bound to its row
+inline bool checkTimelines() {
+  bool ok = TimelinePlayer::valid(TL_STARTUP, sizeof(TL_STARTUP));
+  for (uint8_t i = 0; i < BEH_COUNT; i++) {
+    const TimelineRef& r = TIMELINES[i];
+    if (r.data[2] != i || !TimelinePlayer::valid(r.data, r.len)) {
+      Serial.printf("[TIMELINE] Built-in timeline %d (%s) is malformed\n", i, BEHAVIORS[i].name);
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+#endif
@@ -5,6 +5,9 @@
 #include <WebSocketsClient.h>
 #include <ArduinoJson.h>
 #include "config.h"
+#include "frame_governor.h"
+#include "power_budget.h"
+#include "audio_spectrum.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 
@@ -18,13 +21,17 @@ enum WsMessageType {
   WS_MSG_REQUEST_STATE,
   WS_MSG_STOPWATCH_START,
   WS_MSG_STOPWATCH_STOP,
-  WS_MSG_STOPWATCH_RESET
+  WS_MSG_STOPWATCH_RESET,
+  WS_MSG_OLED_MIRROR,
+  WS_MSG_GESTURE,
+  WS_MSG_BINARY         // binary frame: timeline ('T') or gesture ('G') blob, see binary()
 };
 
 // Queue message structure
 struct WsQueueMessage {
   WsMessageType type;
   char data[128];      // For strings like behavior name, color, URL
+  char text[SUBTITLE_MAX_CHARS + 1]; // play_audio: spoken text, for subtitles
   int intValue;        // For integers like servo angle
 };
 
@@ -35,6 +42,8 @@ private:
   String serverHost;
   int serverPort;
   QueueHandle_t messageQueue;
+  uint8_t binary_[TIMELINE_MAX_BYTES];
+  uint16_t binaryLen_ = 0;           // a blob is waiting for binaryDone()
 
   void handleEvent(WStype_t type, uint8_t* payload, size_t len) {
     switch(type) {
@@ -52,6 +61,10 @@ private:
       case WStype_TEXT:
         handleMessage(payload, len);
         break;
+
+      case WStype_BIN:
+        handleBinary(payload, len);
+        break;
         
       default:
         break;
@@ -97,6 +110,10 @@ private:
       if (url) {
         strncpy(qMsg.data, url, 127);
       }
+      const char* text = doc["text"];
+      if (text) {
+        strncpy(qMsg.text, text, SUBTITLE_MAX_CHARS);
+      }
     }
     else if (strcmp(msgType, "request_state") == 0) {
       qMsg.type = WS_MSG_REQUEST_STATE;
@@ -110,6 +127,17 @@ private:
     else if (strcmp(msgType, "stopwatch_reset") == 0) {
       qMsg.type = WS_MSG_STOPWATCH_RESET;
     }
+    else if (strcmp(msgType, "oled_mirror") == 0) {
+      qMsg.type = WS_MSG_OLED_MIRROR;
+      qMsg.intValue = doc["enabled"] | false;
+    }
+    else if (strcmp(msgType, "gesture") == 0) {
+      qMsg.type = WS_MSG_GESTURE;
+      const char* name = doc["name"];
+      if (name) {
+        strncpy(qMsg.data, name, 127);
+      }
+    }
     else {
       sendToQueue = false;
     }
@@ -121,6 +149,29 @@ private:
     }
   }
 
+  // Binary frames to the robot are timeline and gesture uploads. The payload only lives
+  // for this callback, so it is copied and its message queued like the rest.
+  void handleBinary(uint8_t* payload, size_t len) {
+    if (binaryLen_) {
+      Serial.println("[WS] Upload still pending, dropped");
+      return;
+    }
+    if (len == 0 || len > TIMELINE_MAX_BYTES) {
+      Serial.printf("[WS] Binary frame of %u bytes ignored\n", (unsigned)len);
+      return;
+    }
+    memcpy(binary_, payload, len);
+    binaryLen_ = len;
+    WsQueueMessage qMsg;
+    memset(&qMsg, 0, sizeof(qMsg));
+    qMsg.type = WS_MSG_BINARY;
+    qMsg.intValue = len;
+    if (xQueueSend(messageQueue, &qMsg, 0) != pdTRUE) {
+      Serial.println("[WS] Queue full, message dropped");
+      binaryLen_ = 0;
+    }
+  }
+
 public:
   void setServer(const char* host, int port) {
     serverHost = host;
@@ -155,6 +206,11 @@ public:
     return xQueueReceive(messageQueue, &msg, 0) == pdTRUE;
   }
 
+  // WS_MSG_BINARY payload; call binaryDone() once it has been used
+  const uint8_t* binary() const { return binary_; }
+  uint16_t binaryLen() const { return binaryLen_; }
+  void binaryDone() { binaryLen_ = 0; }
+
   void sendStatus(const char* event, const char* detail) {
     if (!connected) return;
     
@@ -184,6 +240,67 @@ public:
     ws.sendTXT(output);
   }
   
+  // Frame governor report: current level, time per level, loop section cost,
+  // and the mic spectrum's cycle budget when the microphone is on
+  void sendQuality(const FrameGovernor& gov, const SpectrumStats* spectrum = nullptr) {
+    if (!connected) return;
+    
+    const GovernorStats& st = gov.stats();
+    StaticJsonDocument<512> doc;
+    doc["type"] = "quality";
+    doc["level"] = gov.profile().name;
+    doc["loop_avg_us"] = st.loopAvgUs;
+    doc["over_budget_pct"] = st.overBudgetPct;
+    doc["steps_down"] = st.stepsDown;
+    doc["steps_up"] = st.stepsUp;
+    JsonObject levelMs = doc.createNestedObject("level_ms");
+    for (uint8_t l = 0; l < QUALITY_COUNT; l++) levelMs[QUALITY_PROFILES[l].name] = st.levelMs[l];
+    JsonObject sections = doc.createNestedObject("section_avg_us");
+    for (uint8_t s = 0; s < SECTION_COUNT; s++) sections[LOOP_SECTION_NAMES[s]] = st.sectionAvgUs[s];
+    JsonObject peaks = doc.createNestedObject("section_max_us");
+    for (uint8_t s = 0; s < SECTION_COUNT; s++) peaks[LOOP_SECTION_NAMES[s]] = st.sectionMaxUs[s];
+    if (spectrum) {
+      JsonObject sp = doc.createNestedObject("spectrum");
+      sp["blocks"] = spectrum->blocks;
+      sp["overruns"] = spectrum->overruns;
+      sp["dropped"] = spectrum->dropped;
+      sp["cycles_max"] = spectrum->cyclesMax;
+      sp["budget_cycles"] = SPECTRUM_BUDGET_CYCLES;
+    }
+    
+    String output;
+    serializeJson(doc, output);
+    ws.sendTXT(output);
+  }
+  
+  // Power budget report: estimated draw per load, peak, violations
+  void sendPower(const PowerBudget& power) {
+    if (!connected) return;
+    
+    const PowerStats& st = power.stats();
+    StaticJsonDocument<384> doc;
+    doc["type"] = "power";
+    doc["budget_ma"] = power.budgetMa();
+    doc["total_ma"] = st.totalMa;
+    doc["peak_ma"] = st.peakMa;
+    doc["worst_ma"] = st.worstMa;
+    doc["violations"] = st.violations;
+    doc["over_ms"] = st.overMs;
+    doc["servo_holds"] = st.servoHolds;
+    JsonObject loads = doc.createNestedObject("load_ma");
+    for (uint8_t l = 0; l < LOAD_COUNT; l++) loads[POWER_LOAD_NAMES[l]] = st.loadMa[l];
+    
+    String output;
+    serializeJson(doc, output);
+    ws.sendTXT(output);
+  }
+  
+  // OLED mirror packet (see oled_mirror.h)
+  void sendBinary(const uint8_t* data, size_t len) {
+    if (!connected) return;
+    ws.sendBIN(data, len);
+  }
+  
   void sendRaw(const char* json) {
     if (!connected) return;
     ws.sendTXT(json);
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+"""Cut the PGM frames printed by FrameCheck (src/frame_check.h) out of its
+output and write them as .pgm files.
+
+    build/frame_check --pgm > frames.log     # host build, esp32/host
+    python3 tools/extract_pgm.py frames.log frames/
+"""
+import os
+import sys
+
+
+def extract(log_path, out_dir):
+    os.makedirs(out_dir, exist_ok=True)
+    name, lines, count = None, [], 0
+    with open(log_path, errors="replace") as log:
+        for raw in log:
+            line = raw.rstrip("\r\n")
+            if line.startswith("[PGM END]") and name:
+                with open(os.path.join(out_dir, name), "w") as out:
+                    out.write("\n".join(lines) + "\n")
+                count += 1
+                name, lines = None, []
+            elif line.startswith("[PGM] "):
+                name, lines = os.path.basename(line[6:].strip()), []
+            elif name:
+                lines.append(line)
+    return count
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("usage: extract_pgm.py <serial.log> <out_dir>")
+    print("wrote %d frames" % extract(sys.argv[1], sys.argv[2]))
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""Convert a 128x64 PNG (or PGM) sequence into an anim clip header for
+src/anim_clip.h.
+
+    python3 tools/png2clip.py --name boot --fps 20 clips/boot/*.png > src/clip_boot.h
+
+Frames are thresholded to 1 bit (anything brighter than mid-grey is on),
+packed in SH1106 page layout (the U8g2 full buffer) and stored as:
+
+    [flags][len lo][len hi][RLE payload]     flags bit 0 = keyframe
+
+A keyframe's payload is the whole 1024-byte page buffer, a delta frame's
+payload is the XOR against the previous frame (mostly zeros, so it packs
+well). --keyframe-every bounds how far the player has to decode when it
+seeks or loops; a delta is also replaced by a keyframe when that is smaller.
+
+RLE (PackBits-style):
+    0x00..0x7F  n + 1 literal bytes follow
+    0x80..0xFF  the next byte repeated n - 0x7E times (2..129)
+
+Only the Python standard library is needed (own PNG reader: non-interlaced
+greyscale / RGB / palette / alpha, 1-8 bit).
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+WIDTH, HEIGHT = 128, 64
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG" % path)
+    pos, idat, palette = 8, b"", None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            w, h, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+    if interlace:
+        raise ValueError("%s: interlaced PNGs are not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    if depth > 8:
+        raise ValueError("%s: 16-bit PNGs are not supported" % path)
+
+    raw = zlib.decompress(idat)
+    stride = (w * channels * depth + 7) // 8
+    bpp = max(1, channels * depth // 8)
+    rows, prev, p = [], bytearray(stride), 0
+    for _ in range(h):
+        ftype, line = raw[p], bytearray(raw[p + 1:p + 1 + stride])
+        p += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    maxval = (1 << depth) - 1
+    pixels = []
+    for line in rows:
+        out = []
+        for x in range(w):
+            if depth == 8:
+                px = line[x * channels:(x + 1) * channels]
+            else:
+                bit = x * depth
+                px = [(line[bit >> 3] >> (8 - depth - (bit & 7))) & maxval]
+            if color == 3:
+                r, g, b = palette[px[0]]
+                out.append((r + g + b) / (3 * 255.0))
+            elif color in (0, 4):
+                lum = px[0] / float(maxval)
+                out.append(lum * (px[1] / 255.0) if color == 4 else lum)
+            else:
+                lum = (px[0] + px[1] + px[2]) / (3 * 255.0)
+                out.append(lum * (px[3] / 255.0) if color == 6 else lum)
+        pixels.append(out)
+    return w, h, pixels
+
+
+def read_pgm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    tokens, i = [], 0
+    magic = data[:2]
+    header_fields = 4
+    while len(tokens) < header_fields:
+        while data[i:i + 1].isspace():
+            i += 1
+        if data[i:i + 1] == b"#":
+            while data[i:i + 1] not in (b"\n", b""):
+                i += 1
+            continue
+        j = i
+        while not data[j:j + 1].isspace():
+            j += 1
+        tokens.append(data[i:j])
+        i = j
+    w, h, maxval = int(tokens[1]), int(tokens[2]), int(tokens[3])
+    if magic == b"P5":
+        body = data[i + 1:i + 1 + w * h]
+        values = list(body)
+    elif magic == b"P2":
+        values = [int(v) for v in data[i:].split()][:w * h]
+    else:
+        raise ValueError("%s: only P2/P5 PGM is supported" % path)
+    return w, h, [[values[y * w + x] / float(maxval) for x in range(w)] for y in range(h)]
+
+
+def load_frame(path):
+    if path.lower().endswith(".pgm"):
+        w, h, pixels = read_pgm(path)
+    else:
+        w, h, pixels = read_png(path)
+    if (w, h) != (WIDTH, HEIGHT):
+        raise ValueError("%s: frames must be %dx%d, got %dx%d" % (path, WIDTH, HEIGHT, w, h))
+    buf = bytearray(WIDTH * HEIGHT // 8)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if pixels[y][x] > 0.5:
+                buf[(y >> 3) * WIDTH + x] |= 1 << (y & 7)
+    return bytes(buf)
+
+
+def rle_encode(data):
+    out, i, n = bytearray(), 0, len(data)
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:128]
+
+    while i < n:
+        run = 1
+        while i + run < n and data[i + run] == data[i] and run < 129:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x7E + run)
+            out.append(data[i])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def rle_decode(data, size):
+    out, i = bytearray(), 0
+    while i < len(data):
+        c = data[i]
+        i += 1
+        if c < 0x80:
+            out.extend(data[i:i + c + 1])
+            i += c + 1
+        else:
+            out.extend(bytes([data[i]]) * (c - 0x7E))
+            i += 1
+    if len(out) != size:
+        raise AssertionError("RLE round trip failed")
+    return bytes(out)
+
+
+def encode_clip(frames, keyframe_every):
+    blob, prev, keys = bytearray(), None, 0
+    for index, frame in enumerate(frames):
+        key_payload = rle_encode(frame)
+        payload, flags = key_payload, 1
+        if prev is not None and index % keyframe_every != 0:
+            delta = rle_encode(bytes(a ^ b for a, b in zip(frame, prev)))
+            if len(delta) < len(key_payload):
+                payload, flags = delta, 0
+        rle_decode(payload, len(frame))
+        keys += flags
+        blob += struct.pack("<BH", flags, len(payload)) + payload
+        prev = frame
+    return bytes(blob), keys
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("--name", required=True, help="clip name, e.g. boot -> CLIP_BOOT_*")
+    ap.add_argument("--fps", type=int, default=20)
+    ap.add_argument("--keyframe-every", type=int, default=12)
+    ap.add_argument("frames", nargs="+", help="128x64 PNG/PGM frames, in order")
+    args = ap.parse_args()
+
+    frames = [load_frame(p) for p in args.frames]
+    blob, keys = encode_clip(frames, max(1, args.keyframe_every))
+    sym = "CLIP_" + args.name.upper()
+    raw = len(frames) * WIDTH * HEIGHT // 8
+    bps = len(blob) * args.fps // len(frames)
+
+    w = sys.stdout.write
+    w("#ifndef %s_H\n#define %s_H\n\n" % (sym, sym))
+    w("#include <Arduino.h>\n\n")
+    w("// Generated by tools/png2clip.py from %s .. %s - do not edit.\n"
+      % (os.path.basename(args.frames[0]), os.path.basename(args.frames[-1])))
+    w("// %d frames @ %d fps, %d keyframes, %d bytes (%d raw, %d B/s from flash)\n\n"
+      % (len(frames), args.fps, keys, len(blob), raw, bps))
+    w("static const uint16_t %s_FRAMES = %d;\n" % (sym, len(frames)))
+    w("static const uint8_t %s_FPS = %d;\n" % (sym, args.fps))
+    w("static const uint8_t %s_DATA[] = {\n" % sym)
+    for i in range(0, len(blob), 16):
+        w("  " + ", ".join("0x%02x" % b for b in blob[i:i + 16]) + ",\n")
+    w("};\n\n#endif\n")
+    sys.stderr.write("%s: %d frames, %d keyframes, %d -> %d bytes\n"
+                     % (sym, len(frames), keys, raw, len(blob)))
+
+
+if __name__ == "__main__":
+    main()
@@ -13,6 +13,8 @@ const elements = {
   robotState: document.getElementById('robotState'),
   eyeLeft: document.getElementById('eyeLeft'),
   eyeRight: document.getElementById('eyeRight'),
+  oledPreview: document.getElementById('oledPreview'),
+  oledMirror: document.getElementById('oledMirror'),
   sensorDist: document.getElementById('sensorDistance'),
   sensorTouch: document.getElementById('sensorTouch'),
   chat: document.getElementById('chatMessages'),
@@ -230,9 +232,94 @@ function renderEffects() {
   }
 }
 
+// ==============================================
+// OLED MIRROR - the robot's real framebuffer
+// ==============================================
+// Binary packets from the firmware (esp32/src/oled_mirror.h):
+//   [0] 'O'  [1] flags (bit 0 = keyframe)  [2..3] seq  [4..5] payload length
+//   payload: 1 KB SH1106 page buffer, or XOR delta against the previous
+//   packet, RLE packed (0x00..0x7F = n+1 literals, 0x80..0xFF = repeat next byte n-0x7E times)
+// Settled eyes send nothing, so silence is not an outage: the simulated eyes
+// only come back when the robot or the server connection goes away.
+
+const mirror = {
+  frame: new Uint8Array(1024),
+  seq: -1,
+  synced: false,           // frame holds a keyframe plus every delta since
+  lastResync: 0,
+  image: null
+};
+
+function handleMirrorPacket(buffer) {
+  const p = new Uint8Array(buffer);
+  if (p.length < 6 || p[0] !== 0x4F) return;
+  const key = (p[1] & 1) !== 0;
+  const seq = p[2] | (p[3] << 8);
+  const len = p[4] | (p[5] << 8);
+  if (p.length !== 6 + len) return;
+
+  // A delta only applies on top of the frame right before it
+  if (!key && (!mirror.synced || seq !== ((mirror.seq + 1) & 0xFFFF))) {
+    mirror.synced = false;
+    requestMirrorKeyframe();
+    return;
+  }
+
+  const frame = mirror.frame;
+  let i = 6, o = 0;
+  while (i < p.length && o < 1024) {
+    const c = p[i++];
+    if (c < 0x80) {
+      for (let n = 0; n <= c && o < 1024; n++, o++) frame[o] = key ? p[i + n] : frame[o] ^ p[i + n];
+      i += c + 1;
+    } else {
+      const v = p[i++];
+      for (let n = 0; n < c - 0x7E && o < 1024; n++, o++) frame[o] = key ? v : frame[o] ^ v;
+    }
+  }
+
+  mirror.seq = seq;
+  mirror.synced = true;
+  drawMirror();
+}
+
+// Re-enabling the stream makes the firmware start over with a keyframe
+function requestMirrorKeyframe() {
+  const now = performance.now();
+  if (now - mirror.lastResync < 1000 || !state.ws || !state.isConnected) return;
+  mirror.lastResync = now;
+  state.ws.send(JSON.stringify({ type: 'oled_mirror', enabled: true }));
+}
+
+function drawMirror() {
+  const canvas = elements.oledMirror;
+  if (!canvas) return;
+  const ctx = canvas.getContext('2d');
+  if (!mirror.image) mirror.image = ctx.createImageData(128, 64);
+  const px = mirror.image.data;
+  // Page layout: byte (page * 128 + x), bit n = row page * 8 + n
+  for (let y = 0; y < 64; y++) {
+    const row = (y >> 3) * 128, bit = 1 << (y & 7);
+    for (let x = 0; x < 128; x++) {
+      const on = (mirror.frame[row + x] & bit) !== 0;
+      const j = (y * 128 + x) * 4;
+      px[j] = px[j + 1] = px[j + 2] = on ? 255 : 0;
+      px[j + 3] = 255;
+    }
+  }
+  ctx.putImageData(mirror.image, 0, 0);
+  if (elements.oledPreview) elements.oledPreview.classList.add('mirroring');
+}
+
+function stopMirror() {
+  mirror.synced = false;
+  if (elements.oledPreview) elements.oledPreview.classList.remove('mirroring');
+}
+
 // Network connection
 function connect() {
   state.ws = new WebSocket(CONFIG.WS_URL);
+  state.ws.binaryType = 'arraybuffer';
   
   state.ws.onopen = () => {
     state.isConnected = true;
@@ -244,6 +331,10 @@ function connect() {
   };
 
   state.ws.onmessage = (evt) => {
+    if (evt.data instanceof ArrayBuffer) {
+      handleMirrorPacket(evt.data);
+      return;
+    }
     let msg;
     try {
       msg = JSON.parse(evt.data);
@@ -269,6 +360,7 @@ function connect() {
           }
         } else {
           updateStatus('Robot Offline', 'disconnected');
+          stopMirror();
         }
       }
       // Sync behavior from robot
@@ -297,6 +389,7 @@ function connect() {
 
   state.ws.onclose = () => {
     state.isConnected = false;
+    stopMirror();
     updateStatus('Disconnected', 'disconnected');
     if (elements.input) elements.input.disabled = true;
     if (elements.sendBtn) elements.sendBtn.disabled = true;
@@ -75,6 +75,7 @@ wss.on('connection', (ws, req) => {
         robotWs = ws;
         console.log(`âœ… ROBOT CONNECTED!`);
         broadcast({ type: 'robot_status', state: 'ONLINE' });
+        updateOledMirror();
     } 
     // 2. REGISTER WEB APP
     else {
@@ -84,9 +85,17 @@ wss.on('connection', (ws, req) => {
             type: 'robot_status', 
             state: robotWs ? 'ONLINE' : 'OFFLINE' 
         }));
+        updateOledMirror(); // also makes the robot start over with a keyframe
     }
 
-    ws.on('message', async (message) => {
+    ws.on('message', async (message, isBinary) => {
+        // OLED mirror packets from the robot go to the dashboards untouched,
+        // timeline and gesture blobs from a dashboard go to the robot untouched
+        if (isBinary) {
+            if (ws === robotWs) broadcastBinary(message);
+            else if (robotWs && robotWs.readyState === 1) robotWs.send(message, { binary: true });
+            return;
+        }
         try {
             const msg = JSON.parse(message);
 
@@ -231,6 +240,7 @@ wss.on('connection', (ws, req) => {
             broadcast({ type: 'robot_status', state: 'OFFLINE' });
         } else {
             controllers.delete(ws);
+            updateOledMirror();
         }
     });
 });
@@ -242,4 +252,17 @@ function broadcast(data) {
     }
 }
 
+function broadcastBinary(data) {
+    for (let client of controllers) {
+        if (client.readyState === 1) client.send(data, { binary: true });
+    }
+}
+
+// OLED mirror: the robot only streams its framebuffer while a dashboard is open
+function updateOledMirror() {
+    if (robotWs && robotWs.readyState === 1) {
+        robotWs.send(JSON.stringify({ type: 'oled_mirror', enabled: controllers.size > 0 }));
+    }
+}
+
 server.listen(PORT, '0.0.0.0', () => console.log(`ðŸš€ Listening on Port ${PORT}`));
\ No newline at end of file